@@ -0,0 +1,188 @@
+/*
+ * affine.c
+ * the affine layers, their matrices and mode 7 floors
+ */
+
+#include "gba.h"
+#include "layer.h"
+#include "affine.h"
+
+/* the sine of each angle in 4.12 */
+const short affine_sin[256] = {
+    0, 101, 201, 301, 401, 501, 601, 700,
+    799, 897, 995, 1092, 1189, 1285, 1380, 1474,
+    1567, 1660, 1751, 1842, 1931, 2019, 2106, 2191,
+    2276, 2359, 2440, 2520, 2598, 2675, 2751, 2824,
+    2896, 2967, 3035, 3102, 3166, 3229, 3290, 3349,
+    3406, 3461, 3513, 3564, 3612, 3659, 3703, 3745,
+    3784, 3822, 3857, 3889, 3920, 3948, 3973, 3996,
+    4017, 4036, 4052, 4065, 4076, 4085, 4091, 4095,
+    4096, 4095, 4091, 4085, 4076, 4065, 4052, 4036,
+    4017, 3996, 3973, 3948, 3920, 3889, 3857, 3822,
+    3784, 3745, 3703, 3659, 3612, 3564, 3513, 3461,
+    3406, 3349, 3290, 3229, 3166, 3102, 3035, 2967,
+    2896, 2824, 2751, 2675, 2598, 2520, 2440, 2359,
+    2276, 2191, 2106, 2019, 1931, 1842, 1751, 1660,
+    1567, 1474, 1380, 1285, 1189, 1092, 995, 897,
+    799, 700, 601, 501, 401, 301, 201, 101,
+    0, -101, -201, -301, -401, -501, -601, -700,
+    -799, -897, -995, -1092, -1189, -1285, -1380, -1474,
+    -1567, -1660, -1751, -1842, -1931, -2019, -2106, -2191,
+    -2276, -2359, -2440, -2520, -2598, -2675, -2751, -2824,
+    -2896, -2967, -3035, -3102, -3166, -3229, -3290, -3349,
+    -3406, -3461, -3513, -3564, -3612, -3659, -3703, -3745,
+    -3784, -3822, -3857, -3889, -3920, -3948, -3973, -3996,
+    -4017, -4036, -4052, -4065, -4076, -4085, -4091, -4095,
+    -4096, -4095, -4091, -4085, -4076, -4065, -4052, -4036,
+    -4017, -3996, -3973, -3948, -3920, -3889, -3857, -3822,
+    -3784, -3745, -3703, -3659, -3612, -3564, -3513, -3461,
+    -3406, -3349, -3290, -3229, -3166, -3102, -3035, -2967,
+    -2896, -2824, -2751, -2675, -2598, -2520, -2440, -2359,
+    -2276, -2191, -2106, -2019, -1931, -1842, -1751, -1660,
+    -1567, -1474, -1380, -1285, -1189, -1092, -995, -897,
+    -799, -700, -601, -501, -401, -301, -201, -101,
+};
+
+/* 65536 divided by each number, for dividing by multiplying */
+const unsigned short affine_recip[257] = {
+    0xffff, 0xffff, 0x8000, 0x5555, 0x4000, 0x3333, 0x2aab, 0x2492,
+    0x2000, 0x1c72, 0x199a, 0x1746, 0x1555, 0x13b1, 0x1249, 0x1111,
+    0x1000, 0x0f0f, 0x0e39, 0x0d79, 0x0ccd, 0x0c31, 0x0ba3, 0x0b21,
+    0x0aab, 0x0a3d, 0x09d9, 0x097b, 0x0925, 0x08d4, 0x0889, 0x0842,
+    0x0800, 0x07c2, 0x0788, 0x0750, 0x071c, 0x06eb, 0x06bd, 0x0690,
+    0x0666, 0x063e, 0x0618, 0x05f4, 0x05d1, 0x05b0, 0x0591, 0x0572,
+    0x0555, 0x0539, 0x051f, 0x0505, 0x04ec, 0x04d5, 0x04be, 0x04a8,
+    0x0492, 0x047e, 0x046a, 0x0457, 0x0444, 0x0432, 0x0421, 0x0410,
+    0x0400, 0x03f0, 0x03e1, 0x03d2, 0x03c4, 0x03b6, 0x03a8, 0x039b,
+    0x038e, 0x0382, 0x0376, 0x036a, 0x035e, 0x0353, 0x0348, 0x033e,
+    0x0333, 0x0329, 0x031f, 0x0316, 0x030c, 0x0303, 0x02fa, 0x02f1,
+    0x02e9, 0x02e0, 0x02d8, 0x02d0, 0x02c8, 0x02c1, 0x02b9, 0x02b2,
+    0x02ab, 0x02a4, 0x029d, 0x0296, 0x028f, 0x0289, 0x0283, 0x027c,
+    0x0276, 0x0270, 0x026a, 0x0264, 0x025f, 0x0259, 0x0254, 0x024e,
+    0x0249, 0x0244, 0x023f, 0x023a, 0x0235, 0x0230, 0x022b, 0x0227,
+    0x0222, 0x021e, 0x0219, 0x0215, 0x0211, 0x020c, 0x0208, 0x0204,
+    0x0200, 0x01fc, 0x01f8, 0x01f4, 0x01f0, 0x01ed, 0x01e9, 0x01e5,
+    0x01e2, 0x01de, 0x01db, 0x01d7, 0x01d4, 0x01d1, 0x01ce, 0x01ca,
+    0x01c7, 0x01c4, 0x01c1, 0x01be, 0x01bb, 0x01b8, 0x01b5, 0x01b2,
+    0x01af, 0x01ac, 0x01aa, 0x01a7, 0x01a4, 0x01a1, 0x019f, 0x019c,
+    0x019a, 0x0197, 0x0195, 0x0192, 0x0190, 0x018d, 0x018b, 0x0188,
+    0x0186, 0x0184, 0x0182, 0x017f, 0x017d, 0x017b, 0x0179, 0x0176,
+    0x0174, 0x0172, 0x0170, 0x016e, 0x016c, 0x016a, 0x0168, 0x0166,
+    0x0164, 0x0162, 0x0160, 0x015e, 0x015d, 0x015b, 0x0159, 0x0157,
+    0x0155, 0x0154, 0x0152, 0x0150, 0x014e, 0x014d, 0x014b, 0x0149,
+    0x0148, 0x0146, 0x0144, 0x0143, 0x0141, 0x0140, 0x013e, 0x013d,
+    0x013b, 0x013a, 0x0138, 0x0137, 0x0135, 0x0134, 0x0132, 0x0131,
+    0x012f, 0x012e, 0x012d, 0x012b, 0x012a, 0x0129, 0x0127, 0x0126,
+    0x0125, 0x0123, 0x0122, 0x0121, 0x011f, 0x011e, 0x011d, 0x011c,
+    0x011a, 0x0119, 0x0118, 0x0117, 0x0116, 0x0115, 0x0113, 0x0112,
+    0x0111, 0x0110, 0x010f, 0x010e, 0x010d, 0x010b, 0x010a, 0x0109,
+    0x0108, 0x0107, 0x0106, 0x0105, 0x0104, 0x0103, 0x0102, 0x0101,
+    0x0100,
+};
+
+/* the distance from the eye to the screen for mode 7 is 128 pixels, which
+ * is a shift of 7 */
+#define MODE7_FOCUS_SHIFT 7
+
+/* the matrix for each line of the floor, the one being built and the one
+ * the hblank DMA is working through, the extra line at the end is read by
+ * the DMA at the end of the last line and is never shown */
+static struct BgAffine mode7_lines[2][SCREEN_HEIGHT + 1] __attribute__((aligned(4)));
+static int mode7_back = 0;
+
+/* upload an affine layer and set its control register */
+void affine_load(const struct AffineLayer* layer) {
+    volatile unsigned short* control = layer->bg == 2 ? bg2_control : bg3_control;
+    int size = 16 << layer->size;
+
+    layer_load_tiles(layer->tileset, layer->char_block, 0);
+    layer_reserve_screen_blocks(layer->screen_block, (size * size + 2047) / 2048);
+    layer_copy(screen_block(layer->screen_block), layer->map, size * size);
+
+    *control = layer->priority |                /* priority, 0 is highest, 3 is lowest */
+        (layer->char_block << 2) |              /* the char block the image data is stored in */
+        (0 << 6) |                              /* the mosaic flag */
+        (1 << 7) |                              /* always 256 colors */
+        (layer->screen_block << 8) |            /* the screen block the tile data is stored in */
+        ((layer->wrap ? 1 : 0) << 13) |         /* wrapping flag */
+        (layer->size << 14);                    /* bg size */
+}
+
+/* work out the matrix which rotates and scales a layer */
+IWRAM_CODE void affine_set(struct BgAffine* affine, int angle, int scale_x, int scale_y,
+        int cx, int cy, int sx, int sy) {
+    int sine = affine_sin[angle & 0xff];
+    int cosine = affine_cos(angle & 0xff);
+
+    affine->pa = (cosine * scale_x) >> 12;
+    affine->pb = -(sine * scale_x) >> 12;
+    affine->pc = (sine * scale_y) >> 12;
+    affine->pd = (cosine * scale_y) >> 12;
+
+    /* the texture point at the top left of the screen */
+    affine->x = (cx << 8) - (affine->pa * sx + affine->pb * sy);
+    affine->y = (cy << 8) - (affine->pc * sx + affine->pd * sy);
+}
+
+/* work out the matrix for each line of the floor */
+IWRAM_CODE void mode7_build(const struct Mode7* camera) {
+    struct BgAffine* lines = mode7_lines[mode7_back];
+    int sine = affine_sin[camera->angle & 0xff];
+    int cosine = affine_cos(camera->angle & 0xff);
+    int line = 0;
+
+    /* a horizon above the screen is taken as just above it, so the lines
+     * are never further below it than the reciprocal table goes */
+    int horizon = camera->horizon;
+    if (horizon < -1) {
+        horizon = -1;
+    } else if (horizon > SCREEN_HEIGHT - 1) {
+        horizon = SCREEN_HEIGHT - 1;
+    }
+
+    /* the sky is taken from far off the edge of the map, which is clear */
+    for (; line <= horizon; line++) {
+        lines[line].pa = 0;
+        lines[line].pb = 0;
+        lines[line].pc = 0;
+        lines[line].pd = 0;
+        lines[line].x = -(1 << 20);
+        lines[line].y = -(1 << 20);
+    }
+
+    /* each line below the horizon is a slice of floor further away the
+     * closer it is to the horizon, the texture pixels per screen pixel is
+     * the camera height over the distance below the horizon, and the left
+     * end of the line is that far ahead of the camera and half a screen to
+     * the left, looking along angle 0 is up the map */
+    for (; line < SCREEN_HEIGHT; line++) {
+        int scale = (camera->height * affine_recip[line - horizon]) >> 8;
+        int pa = (scale * cosine) >> 12;
+        int pc = (scale * sine) >> 12;
+
+        lines[line].pa = pa;
+        lines[line].pb = 0;
+        lines[line].pc = pc;
+        lines[line].pd = 0;
+        lines[line].x = camera->x + ((scale * sine) >> (12 - MODE7_FOCUS_SHIFT)) - pa * (SCREEN_WIDTH / 2);
+        lines[line].y = camera->y - ((scale * cosine) >> (12 - MODE7_FOCUS_SHIFT)) - pc * (SCREEN_WIDTH / 2);
+    }
+    lines[SCREEN_HEIGHT] = lines[SCREEN_HEIGHT - 1];
+}
+
+/* the vblank task which starts the floor drawing */
+void mode7_task(void* data) {
+    volatile struct BgAffine* affine = (volatile struct BgAffine*) data;
+    struct BgAffine* lines = mode7_lines[mode7_back];
+    mode7_back ^= 1;
+
+    /* the first line is set now and each hblank sets up the next one */
+    dma_hblank_stop();
+    affine->pa = lines[0].pa;
+    affine->pb = lines[0].pb;
+    affine->pc = lines[0].pc;
+    affine->pd = lines[0].pd;
+    affine->x = lines[0].x;
+    affine->y = lines[0].y;
+    dma_hblank_start(affine, &lines[1], sizeof(struct BgAffine) / 4);
+}
@@ -0,0 +1,81 @@
+/*
+ * affine.h
+ * the rotating and scaling layers bg2 and bg3 have in modes 1 and 2, their
+ * maps are a byte per tile and their tiles are always 256 colors, all of
+ * the math is fixed point with the sines and reciprocals looked up
+ */
+
+#ifndef AFFINE_H
+#define AFFINE_H
+
+#include "gba.h"
+#include "layer.h"
+
+/* angles go from 0 to 255 for a whole turn, and the sines are 4.12 */
+extern const short affine_sin[256];
+#define affine_cos(angle) affine_sin[((angle) + 64) & 0xff]
+
+/* 65536 divided by each number from 0 to 256, with 0 and 1 clamped */
+extern const unsigned short affine_recip[257];
+
+/* the sizes an affine layer can be, in pixels, they are always square */
+enum AffineSize {
+    AFFINE_128,
+    AFFINE_256,
+    AFFINE_512,
+    AFFINE_1024
+};
+
+/* everything needed to set up bg2 or bg3 as an affine layer */
+struct AffineLayer {
+    /* the layer this is, 2 or 3 */
+    int bg;
+
+    /* the tiles, and the map of them from mkaffine, which is the size of
+     * the layer */
+    const struct Tileset* tileset;
+    const unsigned char* map;
+
+    /* where the tiles and the map go in VRAM */
+    int char_block;
+    int screen_block;
+
+    /* 0 is drawn on top, 3 underneath */
+    int priority;
+    enum AffineSize size;
+
+    /* whether the map repeats, if not everything past its edges is clear */
+    int wrap;
+};
+
+/* upload an affine layer's tiles, palette and map, and set its control
+ * register, the tiles and palette are shared with the other layers */
+void affine_load(const struct AffineLayer* layer);
+
+/* work out the matrix which rotates a layer by angle and scales it, the
+ * scales are the texture pixels per screen pixel in 8.8 so 0x80 is twice
+ * the size, and texture point cx, cy ends up at screen point sx, sy */
+IWRAM_CODE void affine_set(struct BgAffine* affine, int angle, int scale_x, int scale_y,
+        int cx, int cy, int sx, int sy);
+
+/* a camera looking across a mode 7 floor, the position is in 24.8 texture
+ * pixels and the height in pixels, lines from the horizon up are left
+ * clear, a horizon above the top of the screen is drawn as if it was just
+ * above it */
+struct Mode7 {
+    int x, y;
+    int height;
+    int angle;
+    int horizon;
+};
+
+/* work out the matrix for each line of the floor as seen from a camera,
+ * into the table the next mode7_task will start, this has to be done every
+ * frame the task is queued since the two tables take turns */
+IWRAM_CODE void mode7_build(const struct Mode7* camera);
+
+/* the vblank task which sets up the first line of the floor, data is the
+ * layer's registers, and starts the hblank DMA which sets up the rest */
+void mode7_task(void* data);
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * anim.c
+ * the sprite animation player
+ */
+
+#include "gba.h"
+#include "sprite.h"
+#include "anim.h"
+
+/* show a frame of a clip on the actor's sprite */
+static void anim_show(struct Anim* anim, int frame) {
+    anim->frame = frame;
+    anim->timer = anim_frames[frame].duration;
+    sprite_set_offset(anim->sprite, anim_frames[frame].tile);
+}
+
+/* attach an actor to its sprite and start a clip */
+void anim_init(struct Anim* anim, struct Sprite* sprite, int clip) {
+    anim->sprite = sprite;
+    anim->clip = clip;
+    anim_show(anim, anim_clips[clip]);
+}
+
+/* start a clip from its first frame, unless it is already playing */
+void anim_play(struct Anim* anim, int clip) {
+    if (anim->clip == clip) {
+        return;
+    }
+    anim->clip = clip;
+    anim_show(anim, anim_clips[clip]);
+}
+
+/* stop the current clip on the frame it is on */
+void anim_pause(struct Anim* anim) {
+    anim->timer = 0;
+}
+
+/* restart the current clip on the frame it is on */
+void anim_resume(struct Anim* anim) {
+    if (anim->timer == 0) {
+        anim->timer = anim_frames[anim->frame].duration;
+    }
+}
+
+/* advance a number of actors by one game frame */
+IWRAM_CODE void anim_update_all(struct Anim* anims, int count) {
+    for (int i = 0; i < count; i++) {
+        struct Anim* anim = &anims[i];
+
+        /* paused actors have a timer of 0, and most actors are part way
+         * through a frame, so this is the only test most of them see */
+        if (anim->timer == 0 || --anim->timer != 0) {
+            continue;
+        }
+
+        /* a play once clip which has finished stays on its last frame with
+         * its timer stopped */
+        const struct AnimFrame* current = &anim_frames[anim->frame];
+        if (current->next == ANIM_END) {
+            continue;
+        }
+
+        /* move to the next frame, the tile is only touched if it changed so
+         * the sprite is only marked dirty when it needs to be */
+        const struct AnimFrame* next = &anim_frames[current->next];
+        anim->frame = current->next;
+        anim->timer = next->duration;
+        if (next->tile != current->tile) {
+            sprite_set_offset(anim->sprite, next->tile);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * anim.h
+ * sprite animation from clips, which are lists of tile offsets and how many
+ * frames to show each one for, the clips are made from anims.txt by the
+ * mkanim tool into anims.h, which the demo includes
+ */
+
+#ifndef ANIM_H
+#define ANIM_H
+
+#include "sprite.h"
+
+/* one frame of a clip, next is the index of the frame which follows it, so
+ * looping and ping-pong clips advance the same way, and ANIM_END on the
+ * last frame of a play once clip, where the actor stops and costs nothing
+ * more to update */
+#define ANIM_END 0xffff
+struct AnimFrame {
+    unsigned short tile;
+    unsigned short next;
+    unsigned char duration;
+};
+
+/* the frames of every clip, and the index of each clip's first frame, these
+ * are in anims.h */
+extern const struct AnimFrame anim_frames[];
+extern const unsigned short anim_clips[];
+
+/* an actor playing a clip on its sprite */
+struct Anim {
+    struct Sprite* sprite;
+
+    /* the clip being played and the index of the frame being shown */
+    unsigned short clip;
+    unsigned short frame;
+
+    /* the number of game frames until the next animation frame, 0 when the
+     * animation is paused */
+    unsigned char timer;
+};
+
+/* attach an actor to its sprite and start a clip */
+void anim_init(struct Anim* anim, struct Sprite* sprite, int clip);
+
+/* start a clip from its first frame, unless it is already playing */
+void anim_play(struct Anim* anim, int clip);
+
+/* stop or restart the current clip on the frame it is on */
+void anim_pause(struct Anim* anim);
+void anim_resume(struct Anim* anim);
+
+/* advance a number of actors by one game frame */
+IWRAM_CODE void anim_update_all(struct Anim* anims, int count);
+
+#endif
@@ -0,0 +1,17 @@
+/* anims.h
+ * generated by mkanim program */
+
+#define ANIM_KOOPA_WALK 0
+#define ANIM_KOOPA_STAND 1
+
+const struct AnimFrame anim_frames [] = {
+    {16, 1, 8},
+    {0, 0, 8},
+    {0, ANIM_END, 1},
+};
+
+const unsigned short anim_clips [] = {
+    0,
+    2,
+};
+
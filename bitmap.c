@@ -0,0 +1,434 @@
+/*
+ * bitmap.c
+ * drawing into the bitmap modes
+ *
+ * the rows of every mode start on a word boundary, so a span fills up to
+ * the first word boundary a pixel or two at a time, then the middle a word
+ * (two or four pixels) at a time, then what is left, clipping is worked
+ * out once for each rectangle or image so the loops which touch the pixels
+ * do not check anything
+ *
+ * polygons are filled a row at a time, the left and right edges are walked
+ * down from the top corner keeping the first pixel right of where each
+ * crosses the middle of the row and an error term, so each row costs a few
+ * adds and a span, and a pixel is drawn exactly when its middle is inside
+ * or on a left edge
+ */
+
+#include "gba.h"
+#include "bitmap.h"
+
+/* the page being drawn into */
+struct Bitmap bitmap_screen = {0, SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_WIDTH, 16};
+
+/* set the display to a bitmap mode */
+void bitmap_init(int mode) {
+    *display_control = mode | BG2_ENABLE;
+
+    if (mode == MODE4) {
+        bitmap_screen.width = SCREEN_WIDTH;
+        bitmap_screen.height = SCREEN_HEIGHT;
+        bitmap_screen.pitch = SCREEN_WIDTH / 2;
+        bitmap_screen.bpp = 8;
+    } else if (mode == MODE5) {
+        bitmap_screen.width = 160;
+        bitmap_screen.height = 128;
+        bitmap_screen.pitch = 160;
+        bitmap_screen.bpp = 16;
+    } else {
+        bitmap_screen.width = SCREEN_WIDTH;
+        bitmap_screen.height = SCREEN_HEIGHT;
+        bitmap_screen.pitch = SCREEN_WIDTH;
+        bitmap_screen.bpp = 16;
+    }
+
+    /* mode 3 only has the one page, the others start out showing the front
+     * one and drawing into the back */
+    bitmap_screen.pixels = mode == MODE3 ? front_buffer : back_buffer;
+}
+
+/* show the page which was drawn into */
+void bitmap_flip() {
+    if ((*display_control & 7) == MODE3) {
+        return;
+    }
+
+    if (bitmap_screen.pixels == back_buffer) {
+        *display_control |= SHOW_BACK;
+        bitmap_screen.pixels = front_buffer;
+    } else {
+        *display_control &= ~SHOW_BACK;
+        bitmap_screen.pixels = back_buffer;
+    }
+}
+
+/* put one 8-bit pixel into a row, keeping the other half of its halfword */
+static inline void bitmap_plot8(volatile unsigned short* row, int x, unsigned int color) {
+    volatile unsigned short* p = row + (x >> 1);
+    if (x & 1) {
+        *p = (*p & 0x00ff) | (color << 8);
+    } else {
+        *p = (*p & 0xff00) | color;
+    }
+}
+
+/* a pixel, left out if it is off the bitmap */
+void bitmap_pixel(const struct Bitmap* bitmap, int x, int y, unsigned int color) {
+    if ((unsigned int) x >= (unsigned int) bitmap->width ||
+            (unsigned int) y >= (unsigned int) bitmap->height) {
+        return;
+    }
+
+    volatile unsigned short* row = bitmap->pixels + y * bitmap->pitch;
+    if (bitmap->bpp == 16) {
+        row[x] = color;
+    } else {
+        bitmap_plot8(row, x, color);
+    }
+}
+
+/* fill part of a row */
+IWRAM_CODE void bitmap_span(const struct Bitmap* bitmap, int x, int y, int length,
+        unsigned int color) {
+    volatile unsigned short* row = bitmap->pixels + y * bitmap->pitch;
+    volatile unsigned short* p;
+    volatile unsigned int* words;
+    unsigned int fill;
+
+    if (length <= 0) {
+        return;
+    }
+
+    if (bitmap->bpp == 16) {
+        p = row + x;
+        fill = color | (color << 16);
+
+        /* a halfword to get to a word boundary, then two pixels a word */
+        if ((unsigned long) p & 2) {
+            *p++ = color;
+            length--;
+        }
+        words = (volatile unsigned int*) p;
+        for (; length >= 2; length -= 2) {
+            *words++ = fill;
+        }
+        if (length) {
+            *(volatile unsigned short*) words = color;
+        }
+        return;
+    }
+
+    /* an odd pixel on the left shares its halfword */
+    if (x & 1) {
+        bitmap_plot8(row, x, color);
+        x++;
+        length--;
+    }
+    p = row + (x >> 1);
+    fill = (color & 0xff) * 0x01010101;
+
+    /* then pairs of pixels to get to a word boundary, four pixels a word,
+     * the last pair, and a last pixel which shares its halfword */
+    if (((unsigned long) p & 2) && length >= 2) {
+        *p++ = fill;
+        length -= 2;
+    }
+    words = (volatile unsigned int*) p;
+    for (; length >= 4; length -= 4) {
+        *words++ = fill;
+    }
+    p = (volatile unsigned short*) words;
+    if (length >= 2) {
+        *p++ = fill;
+        length -= 2;
+    }
+    if (length) {
+        *p = (*p & 0xff00) | (color & 0xff);
+    }
+}
+
+/* a filled rectangle, clipped once and then drawn a span at a time */
+void bitmap_rect(const struct Bitmap* bitmap, int x, int y, int width, int height,
+        unsigned int color) {
+    int right = x + width;
+    int bottom = y + height;
+
+    if (x < 0) {
+        x = 0;
+    }
+    if (y < 0) {
+        y = 0;
+    }
+    if (right > bitmap->width) {
+        right = bitmap->width;
+    }
+    if (bottom > bitmap->height) {
+        bottom = bitmap->height;
+    }
+
+    for (; y < bottom; y++) {
+        bitmap_span(bitmap, x, y, right - x, color);
+    }
+}
+
+/* a line, by Bresenham's method */
+IWRAM_CODE void bitmap_line(const struct Bitmap* bitmap, int x0, int y0, int x1, int y1,
+        unsigned int color) {
+    int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int dy = y1 > y0 ? y0 - y1 : y1 - y0;
+    int step_x = x1 > x0 ? 1 : -1;
+    int step_y = y1 > y0 ? 1 : -1;
+    int error = dx + dy;
+
+    /* a line which goes off the bitmap checks each pixel */
+    if ((unsigned int) x0 >= (unsigned int) bitmap->width ||
+            (unsigned int) x1 >= (unsigned int) bitmap->width ||
+            (unsigned int) y0 >= (unsigned int) bitmap->height ||
+            (unsigned int) y1 >= (unsigned int) bitmap->height) {
+        for (;;) {
+            bitmap_pixel(bitmap, x0, y0, color);
+            if (x0 == x1 && y0 == y1) {
+                break;
+            }
+            int twice = error * 2;
+            if (twice >= dy) {
+                error += dy;
+                x0 += step_x;
+            }
+            if (twice <= dx) {
+                error += dx;
+                y0 += step_y;
+            }
+        }
+        return;
+    }
+
+    /* a flat line is a span */
+    if (dy == 0) {
+        bitmap_span(bitmap, x0 < x1 ? x0 : x1, y0, dx + 1, color);
+        return;
+    }
+
+    /* otherwise step a pointer along, or in mode 4 the row and the x */
+    volatile unsigned short* row = bitmap->pixels + y0 * bitmap->pitch;
+    int row_step = step_y * bitmap->pitch;
+    if (bitmap->bpp == 16) {
+        volatile unsigned short* p = row + x0;
+        volatile unsigned short* end = bitmap->pixels + y1 * bitmap->pitch + x1;
+        for (;;) {
+            *p = color;
+            if (p == end) {
+                break;
+            }
+            int twice = error * 2;
+            if (twice >= dy) {
+                error += dy;
+                p += step_x;
+            }
+            if (twice <= dx) {
+                error += dx;
+                p += row_step;
+            }
+        }
+        return;
+    }
+
+    unsigned int high = color << 8;
+    for (;;) {
+        volatile unsigned short* p = row + (x0 >> 1);
+        *p = x0 & 1 ? (*p & 0x00ff) | high : (*p & 0xff00) | color;
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+        int twice = error * 2;
+        if (twice >= dy) {
+            error += dy;
+            x0 += step_x;
+        }
+        if (twice <= dx) {
+            error += dx;
+            y0 += step_y;
+            row += row_step;
+        }
+    }
+}
+
+/* an edge of a polygon being walked down, x is the first pixel whose
+ * middle is on or right of where the edge crosses the middle of the row,
+ * and error is how far right of the crossing that middle is, in steps of a
+ * divisor'th of a pixel, so the edge moves on exactly to the next row by
+ * adding its step to x and taking its remainder off the error */
+struct BitmapEdge {
+    int corner;
+    int bottom;
+    int x;
+    int error;
+    int step;
+    int remainder;
+    int divisor;
+};
+
+/* move an edge on to the next corners around the polygon until it finds
+ * one which covers row y, returning 0 if it has gone past the bottom */
+static int bitmap_edge(struct BitmapEdge* edge, const struct BitmapPoint* points, int count,
+        int direction, int y) {
+    for (int i = 0; i < count; i++) {
+        const struct BitmapPoint* from = &points[edge->corner];
+        edge->corner += direction;
+        if (edge->corner < 0) {
+            edge->corner = count - 1;
+        } else if (edge->corner == count) {
+            edge->corner = 0;
+        }
+        const struct BitmapPoint* to = &points[edge->corner];
+
+        if (to->y > y) {
+            int height = to->y - from->y;
+            int across = to->x - from->x;
+            int divisor = height * 2;
+
+            /* the crossing less half a pixel is from->x plus this over the
+             * divisor, rounded up it is the first pixel */
+            int offset = across * ((y - from->y) * 2 + 1) - height;
+            int x = offset >= 0 ? (offset + divisor - 1) / divisor : -(-offset / divisor);
+
+            edge->bottom = to->y;
+            edge->x = from->x + x;
+            edge->error = x * divisor - offset;
+            edge->step = across >= 0 ? across / height : -((height - 1 - across) / height);
+            edge->remainder = across * 2 - edge->step * divisor;
+            edge->divisor = divisor;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* move an edge down a row */
+static inline void bitmap_edge_step(struct BitmapEdge* edge) {
+    edge->x += edge->step;
+    edge->error -= edge->remainder;
+    if (edge->error < 0) {
+        edge->error += edge->divisor;
+        edge->x++;
+    }
+}
+
+/* a filled convex polygon */
+IWRAM_CODE void bitmap_polygon(const struct Bitmap* bitmap, const struct BitmapPoint* points,
+        int count, unsigned int color) {
+    struct BitmapEdge left, right;
+    int top = 0, bottom;
+
+    if (count < 3) {
+        return;
+    }
+
+    /* the edges start from the top corner, going opposite ways round */
+    bottom = points[0].y;
+    for (int i = 1; i < count; i++) {
+        if (points[i].y < points[top].y) {
+            top = i;
+        }
+        if (points[i].y > bottom) {
+            bottom = points[i].y;
+        }
+    }
+
+    int y = points[top].y < 0 ? 0 : points[top].y;
+    if (bottom > bitmap->height) {
+        bottom = bitmap->height;
+    }
+    if (y >= bottom) {
+        return;
+    }
+
+    left.corner = top;
+    right.corner = top;
+    if (!bitmap_edge(&left, points, count, -1, y) || !bitmap_edge(&right, points, count, 1, y)) {
+        return;
+    }
+
+    for (;;) {
+        /* the pixels whose middles are from the left edge up to but not
+         * including the right, which are the other way round if the
+         * corners are */
+        int x0 = left.x;
+        int x1 = right.x;
+        if (x0 > x1) {
+            int swap = x0;
+            x0 = x1;
+            x1 = swap;
+        }
+        if (x0 < 0) {
+            x0 = 0;
+        }
+        if (x1 > bitmap->width) {
+            x1 = bitmap->width;
+        }
+        bitmap_span(bitmap, x0, y, x1 - x0, color);
+
+        if (++y >= bottom) {
+            return;
+        }
+        bitmap_edge_step(&left);
+        bitmap_edge_step(&right);
+        if (y >= left.bottom && !bitmap_edge(&left, points, count, -1, y)) {
+            return;
+        }
+        if (y >= right.bottom && !bitmap_edge(&right, points, count, 1, y)) {
+            return;
+        }
+    }
+}
+
+/* a filled triangle */
+void bitmap_triangle(const struct Bitmap* bitmap, int x0, int y0, int x1, int y1, int x2, int y2,
+        unsigned int color) {
+    struct BitmapPoint points[3] = {{x0, y0}, {x1, y1}, {x2, y2}};
+    bitmap_polygon(bitmap, points, 3, color);
+}
+
+/* copy an image, leaving out the key color */
+IWRAM_CODE void bitmap_blit(const struct Bitmap* bitmap, int x, int y, const void* image,
+        int width, int height, unsigned int key) {
+    int left = x < 0 ? 0 : x;
+    int top = y < 0 ? 0 : y;
+    int right = x + width > bitmap->width ? bitmap->width : x + width;
+    int bottom = y + height > bitmap->height ? bitmap->height : y + height;
+
+    if (left >= right || top >= bottom) {
+        return;
+    }
+
+    for (int row_y = top; row_y < bottom; row_y++) {
+        volatile unsigned short* row = bitmap->pixels + row_y * bitmap->pitch;
+
+        if (bitmap->bpp == 16) {
+            const unsigned short* source = (const unsigned short*) image + (row_y - y) * width;
+            for (int dx = left; dx < right; dx++) {
+                if (source[dx - x] != key) {
+                    row[dx] = source[dx - x];
+                }
+            }
+            continue;
+        }
+
+        /* in mode 4 go a halfword at a time, writing it whole when both of
+         * its pixels are there and merging it when only one is */
+        const unsigned char* source = (const unsigned char*) image + (row_y - y) * width;
+        for (int dx = left & ~1; dx < right; dx += 2) {
+            unsigned int low = dx >= left ? source[dx - x] : key;
+            unsigned int high = dx + 1 < right ? source[dx + 1 - x] : key;
+            volatile unsigned short* p = row + (dx >> 1);
+
+            if (low != key && high != key) {
+                *p = low | (high << 8);
+            } else if (low != key) {
+                *p = (*p & 0xff00) | low;
+            } else if (high != key) {
+                *p = (*p & 0x00ff) | (high << 8);
+            }
+        }
+    }
+}
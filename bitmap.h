@@ -0,0 +1,74 @@
+/*
+ * bitmap.h
+ * drawing into the bitmap modes, mode 3 is one 240x160 page of 16-bit
+ * colors, mode 4 is two 240x160 pages of 8-bit palette indices and mode 5
+ * is two 160x128 pages of 16-bit colors, everything is drawn into the page
+ * which is not being shown until bitmap_flip swaps them
+ */
+
+#ifndef BITMAP_H
+#define BITMAP_H
+
+/* a page of pixels, VRAM can only be written 16 or 32 bits at a time, so in
+ * mode 4 a lone pixel has to be read and written back with its neighbour */
+struct Bitmap {
+    volatile unsigned short* pixels;
+
+    /* the size in pixels, the halfwords from one row to the next, and the
+     * bits in a pixel, 8 or 16 */
+    int width;
+    int height;
+    int pitch;
+    int bpp;
+};
+
+/* a corner of a polygon */
+struct BitmapPoint {
+    short x;
+    short y;
+};
+
+/* the page being drawn into */
+extern struct Bitmap bitmap_screen;
+
+/* set the display to mode 3, 4 or 5 and draw into the page which is not
+ * shown */
+void bitmap_init(int mode);
+
+/* show the page which was drawn into and draw into the other one, mode 3
+ * only has the one page so this does nothing there */
+void bitmap_flip();
+
+/* a pixel, which is left out if it is off the bitmap */
+void bitmap_pixel(const struct Bitmap* bitmap, int x, int y, unsigned int color);
+
+/* length pixels of a row from x rightwards, which must all be on the
+ * bitmap, the middle is filled a word at a time */
+void bitmap_span(const struct Bitmap* bitmap, int x, int y, int length, unsigned int color);
+
+/* a filled rectangle, clipped to the bitmap */
+void bitmap_rect(const struct Bitmap* bitmap, int x, int y, int width, int height,
+        unsigned int color);
+
+/* a line from one point to another, both ends included, a line with an end
+ * off the bitmap checks each pixel */
+void bitmap_line(const struct Bitmap* bitmap, int x0, int y0, int x1, int y1,
+        unsigned int color);
+
+/* a filled convex polygon, its corners in order either way round and
+ * within 8192 pixels of the bitmap, clipped to it, a pixel is drawn when
+ * its middle is inside or on a left edge, so a polygon which shares an edge
+ * with another draws no pixel twice and leaves no gap */
+void bitmap_polygon(const struct Bitmap* bitmap, const struct BitmapPoint* points, int count,
+        unsigned int color);
+
+/* a filled triangle in one color */
+void bitmap_triangle(const struct Bitmap* bitmap, int x0, int y0, int x1, int y1, int x2, int y2,
+        unsigned int color);
+
+/* copy an image which has the same bits a pixel as the bitmap, clipped to
+ * the bitmap, the pixels which are the key color are left out */
+void bitmap_blit(const struct Bitmap* bitmap, int x, int y, const void* image,
+        int width, int height, unsigned int key);
+
+#endif
@@ -0,0 +1,28 @@
+/*
+ * blit.c
+ * compiled sprites for mode 4
+ *
+ * a sprite's functions only know the mode 4 page's pitch and where the
+ * pixels go in it, so picking one is all that is left to do here, along
+ * with handing the sprites which hang off the page to bitmap_blit
+ */
+
+#include "gba.h"
+#include "blit.h"
+#include "blits.h"
+
+/* draw a sprite by its compiled functions, or clipped */
+void blit_sprite(const struct Bitmap* bitmap, const struct CompiledSprite* sprite, int x, int y) {
+    if (bitmap->bpp != 8) {
+        return;
+    }
+
+    if (x < 0 || y < 0 || x + sprite->width > bitmap->width ||
+            y + sprite->height > bitmap->height || bitmap->pitch != SCREEN_WIDTH / 2) {
+        bitmap_blit(bitmap, x, y, sprite->pixels, sprite->width, sprite->height, 0);
+        return;
+    }
+
+    volatile unsigned char* row = (volatile unsigned char*) (bitmap->pixels + y * bitmap->pitch);
+    sprite->draw[x & 3](row + (x & ~3));
+}
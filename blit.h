@@ -0,0 +1,36 @@
+/*
+ * blit.h
+ * compiled sprites for mode 4, the bowl and the falling objects drawn by
+ * functions made by the mkblit tool which store their pixels straight into
+ * the page a word or halfword at a time
+ */
+
+#ifndef BLIT_H
+#define BLIT_H
+
+#include "bitmap.h"
+
+/* the frames of objects.h */
+#define BLIT_OBJECT_SPRITES 5
+
+/* a compiled sprite, the pixels are in rows with 0 see through and are
+ * only used when it has to be clipped, otherwise one of the functions
+ * draws it, picked by where its left edge is in a word of the page and
+ * given the address of that word */
+struct CompiledSprite {
+    int width;
+    int height;
+    const unsigned char* pixels;
+    void (*draw[4])(volatile unsigned char* dest);
+};
+
+/* the sprites, from blits.h */
+extern const struct CompiledSprite bowl_sprites[];
+extern const struct CompiledSprite object_sprites[];
+
+/* draw a sprite with its top left at x, y, a sprite which is all on a mode
+ * 4 page is drawn by its compiled functions, otherwise it is clipped and
+ * drawn by bitmap_blit, anything but a mode 4 page is left alone */
+void blit_sprite(const struct Bitmap* bitmap, const struct CompiledSprite* sprite, int x, int y);
+
+#endif
@@ -0,0 +1,7829 @@
+/* blits.h
+ * generated by mkblit program */
+
+#include "blit.h"
+
+/* the halfword and the word a number of bytes into the page */
+#define HALF(offset) (*(volatile unsigned short*) (dest + (offset)))
+#define WORD(offset) (*(volatile unsigned int*) (dest + (offset)))
+
+/* bowl frame 0, 555 opaque pixels */
+static const unsigned char bowl_0_pixels [] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x15, 0x16, 0x05, 0x17, 0x18, 0x19,
+    0x05, 0x24, 0x25, 0x18, 0x26, 0x18, 0x0b, 0x27, 0x2b, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x0a, 0x1a, 0x1b, 0x1b, 0x0b, 0x1c, 0x1c, 0x1c,
+    0x0b, 0x23, 0x1c, 0x1c, 0x23, 0x0b, 0x28, 0x28, 0x29, 0x05, 0x05, 0x2d, 0x2e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x1d, 0x1e, 0x1f, 0x1d, 0x10, 0x10, 0x10, 0x10,
+    0x23, 0x10, 0x1c, 0x1c, 0x1c, 0x23, 0x10, 0x15, 0x15, 0x10, 0x0b, 0x2f, 0x24, 0x30, 0x31, 0x00,
+    0x00, 0x00, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x20, 0x1e, 0x1e, 0x0c, 0x0b, 0x0b, 0x21, 0x0b,
+    0x21, 0x02, 0x02, 0x28, 0x02, 0x21, 0x28, 0x28, 0x32, 0x28, 0x28, 0x29, 0x33, 0x34, 0x35, 0x09,
+    0x00, 0x00, 0x0f, 0x10, 0x0b, 0x0c, 0x11, 0x12, 0x07, 0x1b, 0x0c, 0x22, 0x0b, 0x1c, 0x1c, 0x23,
+    0x10, 0x10, 0x15, 0x23, 0x0b, 0x02, 0x29, 0x2a, 0x34, 0x36, 0x37, 0x34, 0x38, 0x33, 0x37, 0x03,
+    0x00, 0x00, 0x2f, 0x39, 0x22, 0x22, 0x3a, 0x3b, 0x52, 0x1e, 0x1d, 0x0c, 0x0b, 0x0b, 0x23, 0x10,
+    0x0b, 0x28, 0x29, 0x62, 0x38, 0x34, 0x34, 0x38, 0x38, 0x38, 0x34, 0x34, 0x34, 0x63, 0x56, 0x68,
+    0x00, 0x00, 0x3c, 0x20, 0x0c, 0x22, 0x1d, 0x0d, 0x08, 0x1d, 0x22, 0x0b, 0x10, 0x10, 0x0b, 0x28,
+    0x29, 0x57, 0x38, 0x60, 0x33, 0x33, 0x33, 0x38, 0x38, 0x38, 0x38, 0x38, 0x34, 0x34, 0x32, 0x69,
+    0x00, 0x00, 0x3d, 0x3e, 0x3a, 0x3f, 0x1f, 0x20, 0x11, 0x53, 0x1d, 0x10, 0x02, 0x3e, 0x33, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x6a, 0x38, 0x6b, 0x29, 0x0b, 0x20, 0x6c,
+    0x00, 0x00, 0x40, 0x41, 0x42, 0x3e, 0x0b, 0x10, 0x3f, 0x20, 0x10, 0x3e, 0x38, 0x34, 0x37, 0x54,
+    0x37, 0x46, 0x46, 0x46, 0x34, 0x63, 0x38, 0x33, 0x62, 0x32, 0x23, 0x23, 0x28, 0x22, 0x67, 0x6d,
+    0x00, 0x00, 0x00, 0x43, 0x44, 0x45, 0x46, 0x34, 0x30, 0x0b, 0x0b, 0x55, 0x32, 0x28, 0x02, 0x02,
+    0x21, 0x21, 0x23, 0x23, 0x23, 0x28, 0x28, 0x0b, 0x10, 0x08, 0x3b, 0x10, 0x24, 0x25, 0x6c, 0x6e,
+    0x00, 0x00, 0x00, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4e, 0x56, 0x57, 0x57, 0x58, 0x59, 0x59, 0x5a,
+    0x22, 0x22, 0x1d, 0x1d, 0x0c, 0x59, 0x19, 0x64, 0x6f, 0x08, 0x70, 0x30, 0x24, 0x1a, 0x71, 0x00,
+    0x00, 0x00, 0x00, 0x4c, 0x43, 0x4d, 0x49, 0x4e, 0x45, 0x5b, 0x5c, 0x5d, 0x46, 0x56, 0x5e, 0x5e,
+    0x65, 0x65, 0x25, 0x66, 0x25, 0x25, 0x60, 0x60, 0x16, 0x08, 0x72, 0x60, 0x25, 0x65, 0x56, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4f, 0x50, 0x51, 0x50, 0x45, 0x4e, 0x5f, 0x5d, 0x60, 0x61, 0x5e, 0x05,
+    0x25, 0x05, 0x25, 0x25, 0x67, 0x25, 0x56, 0x57, 0x10, 0x08, 0x02, 0x24, 0x73, 0x74, 0x2b, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x75, 0x76, 0x4d, 0x47, 0x51, 0x4e, 0x7d, 0x5f, 0x61, 0x36, 0x24, 0x05,
+    0x05, 0x05, 0x25, 0x25, 0x67, 0x57, 0x56, 0x05, 0x20, 0x8c, 0x05, 0x25, 0x8d, 0x8e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x77, 0x4f, 0x4b, 0x51, 0x47, 0x50, 0x5b, 0x49, 0x5f, 0x5f, 0x7e, 0x24,
+    0x25, 0x25, 0x25, 0x67, 0x85, 0x54, 0x57, 0x59, 0x8c, 0x23, 0x05, 0x67, 0x8f, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x4f, 0x79, 0x47, 0x47, 0x5b, 0x49, 0x49, 0x5f, 0x56, 0x7e,
+    0x65, 0x25, 0x67, 0x05, 0x46, 0x38, 0x86, 0x3a, 0x09, 0x19, 0x25, 0x91, 0x24, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x43, 0x43, 0x47, 0x50, 0x4b, 0x79, 0x50, 0x7f, 0x56, 0x7e,
+    0x5e, 0x87, 0x60, 0x37, 0x2a, 0x59, 0x59, 0x1c, 0x6f, 0x91, 0x67, 0x92, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x76, 0x4a, 0x49, 0x79, 0x50, 0x5b, 0x7f, 0x5c, 0x60,
+    0x60, 0x36, 0x54, 0x24, 0x59, 0x29, 0x30, 0x19, 0x25, 0x67, 0x93, 0x27, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x4f, 0x79, 0x4e, 0x3c, 0x80, 0x5c, 0x5f, 0x81,
+    0x4e, 0x54, 0x5e, 0x05, 0x58, 0x33, 0x85, 0x67, 0x67, 0x93, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x83, 0x83, 0x4a, 0x7d, 0x4d, 0x5f, 0x34,
+    0x57, 0x05, 0x60, 0x88, 0x05, 0x89, 0x73, 0x8a, 0x6d, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x76, 0x48, 0x4e, 0x4e, 0x50,
+    0x50, 0x5f, 0x34, 0x5e, 0x25, 0x24, 0x3c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x48, 0x97, 0x3c,
+    0x5c, 0x80, 0x61, 0x61, 0x7f, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x4f, 0x99, 0x9a,
+    0x4f, 0x3d, 0x44, 0x9b, 0x71, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static void blit_bowl_0_0(volatile unsigned char* dest) {
+    dest += 720;
+    WORD(8) = 0x16151413;
+    WORD(12) = 0x19181705;
+    WORD(16) = 0x18252405;
+    WORD(20) = 0x270b1826;
+    HALF(24) = 0x2c2b;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x0100;
+    HALF(6) = 0x0302;
+    WORD(8) = 0x1b1b1a0a;
+    WORD(12) = 0x1c1c1c0b;
+    WORD(16) = 0x1c1c230b;
+    WORD(20) = 0x28280b23;
+    WORD(24) = 0x2d050529;
+    HALF(28) = (HALF(28) & 0xff00) | 0x2e;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0400;
+    WORD(4) = 0x08070605;
+    WORD(8) = 0x1d1f1e1d;
+    WORD(12) = 0x10101010;
+    WORD(16) = 0x1c1c1023;
+    WORD(20) = 0x1510231c;
+    WORD(24) = 0x2f0b1015;
+    HALF(28) = 0x3024;
+    HALF(30) = (HALF(30) & 0xff00) | 0x31;
+    dest += 240;
+    HALF(2) = 0x0a09;
+    WORD(4) = 0x0e0d0c0b;
+    WORD(8) = 0x0c1e1e20;
+    WORD(12) = 0x0b210b0b;
+    WORD(16) = 0x28020221;
+    WORD(20) = 0x28282102;
+    WORD(24) = 0x29282832;
+    WORD(28) = 0x09353433;
+    dest += 240;
+    HALF(2) = 0x100f;
+    WORD(4) = 0x12110c0b;
+    WORD(8) = 0x220c1b07;
+    WORD(12) = 0x231c1c0b;
+    WORD(16) = 0x23151010;
+    WORD(20) = 0x2a29020b;
+    WORD(24) = 0x34373634;
+    WORD(28) = 0x03373338;
+    dest += 240;
+    HALF(2) = 0x392f;
+    WORD(4) = 0x3b3a2222;
+    WORD(8) = 0x0c1d1e52;
+    WORD(12) = 0x10230b0b;
+    WORD(16) = 0x6229280b;
+    WORD(20) = 0x38343438;
+    WORD(24) = 0x34343838;
+    WORD(28) = 0x68566334;
+    dest += 240;
+    HALF(2) = 0x203c;
+    WORD(4) = 0x0d1d220c;
+    WORD(8) = 0x0b221d08;
+    WORD(12) = 0x280b1010;
+    WORD(16) = 0x60385729;
+    WORD(20) = 0x38333333;
+    WORD(24) = 0x38383838;
+    WORD(28) = 0x69323434;
+    dest += 240;
+    HALF(2) = 0x3e3d;
+    WORD(4) = 0x201f3f3a;
+    WORD(8) = 0x101d5311;
+    WORD(12) = 0x38333e02;
+    WORD(16) = 0x38383838;
+    WORD(20) = 0x38383838;
+    WORD(24) = 0x6b386a38;
+    WORD(28) = 0x6c200b29;
+    dest += 240;
+    HALF(2) = 0x4140;
+    WORD(4) = 0x100b3e42;
+    WORD(8) = 0x3e10203f;
+    WORD(12) = 0x54373438;
+    WORD(16) = 0x46464637;
+    WORD(20) = 0x33386334;
+    WORD(24) = 0x23233262;
+    WORD(28) = 0x6d672228;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x4300;
+    WORD(4) = 0x34464544;
+    WORD(8) = 0x550b0b30;
+    WORD(12) = 0x02022832;
+    WORD(16) = 0x23232121;
+    WORD(20) = 0x0b282823;
+    WORD(24) = 0x103b0810;
+    WORD(28) = 0x6e6c2524;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x4700;
+    WORD(4) = 0x4b4a4948;
+    WORD(8) = 0x5757564e;
+    WORD(12) = 0x5a595958;
+    WORD(16) = 0x1d1d2222;
+    WORD(20) = 0x6419590c;
+    WORD(24) = 0x3070086f;
+    HALF(28) = 0x1a24;
+    HALF(30) = (HALF(30) & 0xff00) | 0x71;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x4c00;
+    WORD(4) = 0x4e494d43;
+    WORD(8) = 0x5d5c5b45;
+    WORD(12) = 0x5e5e5646;
+    WORD(16) = 0x66256565;
+    WORD(20) = 0x60602525;
+    WORD(24) = 0x60720816;
+    HALF(28) = 0x6525;
+    HALF(30) = (HALF(30) & 0xff00) | 0x56;
+    dest += 240;
+    WORD(4) = 0x5051504f;
+    WORD(8) = 0x5d5f4e45;
+    WORD(12) = 0x055e6160;
+    WORD(16) = 0x25250525;
+    WORD(20) = 0x57562567;
+    WORD(24) = 0x24020810;
+    HALF(28) = 0x7473;
+    HALF(30) = (HALF(30) & 0xff00) | 0x2b;
+    dest += 240;
+    WORD(4) = 0x474d7675;
+    WORD(8) = 0x5f7d4e51;
+    WORD(12) = 0x05243661;
+    WORD(16) = 0x25250505;
+    WORD(20) = 0x05565767;
+    WORD(24) = 0x25058c20;
+    HALF(28) = 0x8e8d;
+    dest += 240;
+    WORD(4) = 0x514b4f77;
+    WORD(8) = 0x495b5047;
+    WORD(12) = 0x247e5f5f;
+    WORD(16) = 0x67252525;
+    WORD(20) = 0x59575485;
+    WORD(24) = 0x6705238c;
+    HALF(28) = 0x908f;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x7800;
+    HALF(6) = 0x794f;
+    WORD(8) = 0x495b4747;
+    WORD(12) = 0x7e565f49;
+    WORD(16) = 0x05672565;
+    WORD(20) = 0x3a863846;
+    WORD(24) = 0x91251909;
+    HALF(28) = (HALF(28) & 0xff00) | 0x24;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x7a00;
+    HALF(6) = 0x4343;
+    WORD(8) = 0x794b5047;
+    WORD(12) = 0x7e567f50;
+    WORD(16) = 0x3760875e;
+    WORD(20) = 0x1c59592a;
+    WORD(24) = 0x9267916f;
+    dest += 240;
+    HALF(6) = 0x767b;
+    WORD(8) = 0x5079494a;
+    WORD(12) = 0x605c7f5b;
+    WORD(16) = 0x24543660;
+    WORD(20) = 0x19302959;
+    WORD(24) = 0x27936725;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x7c00;
+    WORD(8) = 0x3c4e794f;
+    WORD(12) = 0x815f5c80;
+    WORD(16) = 0x055e544e;
+    WORD(20) = 0x67853358;
+    HALF(24) = 0x9367;
+    HALF(26) = (HALF(26) & 0xff00) | 0x94;
+    dest += 240;
+    WORD(8) = 0x4a838382;
+    WORD(12) = 0x345f4d7d;
+    WORD(16) = 0x88600557;
+    WORD(20) = 0x8a738905;
+    HALF(24) = 0x956d;
+    dest += 240;
+    HALF(10) = 0x7684;
+    WORD(12) = 0x504e4e48;
+    WORD(16) = 0x5e345f50;
+    WORD(20) = 0x8b3c2425;
+    dest += 240;
+    WORD(12) = 0x3c974896;
+    WORD(16) = 0x6161805c;
+    HALF(20) = 0x837f;
+    dest += 240;
+    WORD(12) = 0x9a994f98;
+    WORD(16) = 0x9b443d4f;
+    HALF(20) = 0x9c71;
+    /* 146 stores and 15 merges */
+}
+
+static void blit_bowl_0_1(volatile unsigned char* dest) {
+    dest += 720;
+    HALF(8) = (HALF(8) & 0x00ff) | 0x1300;
+    HALF(10) = 0x1514;
+    WORD(12) = 0x18170516;
+    WORD(16) = 0x25240519;
+    WORD(20) = 0x0b182618;
+    HALF(24) = 0x2b27;
+    HALF(26) = (HALF(26) & 0xff00) | 0x2c;
+    dest += 240;
+    HALF(6) = 0x0201;
+    WORD(8) = 0x1b1a0a03;
+    WORD(12) = 0x1c1c0b1b;
+    WORD(16) = 0x1c230b1c;
+    WORD(20) = 0x280b231c;
+    WORD(24) = 0x05052928;
+    HALF(28) = 0x2e2d;
+    dest += 240;
+    WORD(4) = 0x07060504;
+    WORD(8) = 0x1f1e1d08;
+    WORD(12) = 0x1010101d;
+    WORD(16) = 0x1c102310;
+    WORD(20) = 0x10231c1c;
+    WORD(24) = 0x0b101515;
+    WORD(28) = 0x3130242f;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0900;
+    WORD(4) = 0x0d0c0b0a;
+    WORD(8) = 0x1e1e200e;
+    WORD(12) = 0x210b0b0c;
+    WORD(16) = 0x0202210b;
+    WORD(20) = 0x28210228;
+    WORD(24) = 0x28283228;
+    WORD(28) = 0x35343329;
+    HALF(32) = (HALF(32) & 0xff00) | 0x09;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0f00;
+    WORD(4) = 0x110c0b10;
+    WORD(8) = 0x0c1b0712;
+    WORD(12) = 0x1c1c0b22;
+    WORD(16) = 0x15101023;
+    WORD(20) = 0x29020b23;
+    WORD(24) = 0x3736342a;
+    WORD(28) = 0x37333834;
+    HALF(32) = (HALF(32) & 0xff00) | 0x03;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x2f00;
+    WORD(4) = 0x3a222239;
+    WORD(8) = 0x1d1e523b;
+    WORD(12) = 0x230b0b0c;
+    WORD(16) = 0x29280b10;
+    WORD(20) = 0x34343862;
+    WORD(24) = 0x34383838;
+    WORD(28) = 0x56633434;
+    HALF(32) = (HALF(32) & 0xff00) | 0x68;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x3c00;
+    WORD(4) = 0x1d220c20;
+    WORD(8) = 0x221d080d;
+    WORD(12) = 0x0b10100b;
+    WORD(16) = 0x38572928;
+    WORD(20) = 0x33333360;
+    WORD(24) = 0x38383838;
+    WORD(28) = 0x32343438;
+    HALF(32) = (HALF(32) & 0xff00) | 0x69;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x3d00;
+    WORD(4) = 0x1f3f3a3e;
+    WORD(8) = 0x1d531120;
+    WORD(12) = 0x333e0210;
+    WORD(16) = 0x38383838;
+    WORD(20) = 0x38383838;
+    WORD(24) = 0x386a3838;
+    WORD(28) = 0x200b296b;
+    HALF(32) = (HALF(32) & 0xff00) | 0x6c;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x4000;
+    WORD(4) = 0x0b3e4241;
+    WORD(8) = 0x10203f10;
+    WORD(12) = 0x3734383e;
+    WORD(16) = 0x46463754;
+    WORD(20) = 0x38633446;
+    WORD(24) = 0x23326233;
+    WORD(28) = 0x67222823;
+    HALF(32) = (HALF(32) & 0xff00) | 0x6d;
+    dest += 240;
+    WORD(4) = 0x46454443;
+    WORD(8) = 0x0b0b3034;
+    WORD(12) = 0x02283255;
+    WORD(16) = 0x23212102;
+    WORD(20) = 0x28282323;
+    WORD(24) = 0x3b08100b;
+    WORD(28) = 0x6c252410;
+    HALF(32) = (HALF(32) & 0xff00) | 0x6e;
+    dest += 240;
+    WORD(4) = 0x4a494847;
+    WORD(8) = 0x57564e4b;
+    WORD(12) = 0x59595857;
+    WORD(16) = 0x1d22225a;
+    WORD(20) = 0x19590c1d;
+    WORD(24) = 0x70086f64;
+    WORD(28) = 0x711a2430;
+    dest += 240;
+    WORD(4) = 0x494d434c;
+    WORD(8) = 0x5c5b454e;
+    WORD(12) = 0x5e56465d;
+    WORD(16) = 0x2565655e;
+    WORD(20) = 0x60252566;
+    WORD(24) = 0x72081660;
+    WORD(28) = 0x56652560;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x4f00;
+    HALF(6) = 0x5150;
+    WORD(8) = 0x5f4e4550;
+    WORD(12) = 0x5e61605d;
+    WORD(16) = 0x25052505;
+    WORD(20) = 0x56256725;
+    WORD(24) = 0x02081057;
+    WORD(28) = 0x2b747324;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x7500;
+    HALF(6) = 0x4d76;
+    WORD(8) = 0x7d4e5147;
+    WORD(12) = 0x2436615f;
+    WORD(16) = 0x25050505;
+    WORD(20) = 0x56576725;
+    WORD(24) = 0x058c2005;
+    HALF(28) = 0x8d25;
+    HALF(30) = (HALF(30) & 0xff00) | 0x8e;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x7700;
+    HALF(6) = 0x4b4f;
+    WORD(8) = 0x5b504751;
+    WORD(12) = 0x7e5f5f49;
+    WORD(16) = 0x25252524;
+    WORD(20) = 0x57548567;
+    WORD(24) = 0x05238c59;
+    HALF(28) = 0x8f67;
+    HALF(30) = (HALF(30) & 0xff00) | 0x90;
+    dest += 240;
+    HALF(6) = 0x4f78;
+    WORD(8) = 0x5b474779;
+    WORD(12) = 0x565f4949;
+    WORD(16) = 0x6725657e;
+    WORD(20) = 0x86384605;
+    WORD(24) = 0x2519093a;
+    HALF(28) = 0x2491;
+    dest += 240;
+    HALF(6) = 0x437a;
+    WORD(8) = 0x4b504743;
+    WORD(12) = 0x567f5079;
+    WORD(16) = 0x60875e7e;
+    WORD(20) = 0x59592a37;
+    WORD(24) = 0x67916f1c;
+    HALF(28) = (HALF(28) & 0xff00) | 0x92;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x7b00;
+    WORD(8) = 0x79494a76;
+    WORD(12) = 0x5c7f5b50;
+    WORD(16) = 0x54366060;
+    WORD(20) = 0x30295924;
+    WORD(24) = 0x93672519;
+    HALF(28) = (HALF(28) & 0xff00) | 0x27;
+    dest += 240;
+    WORD(8) = 0x4e794f7c;
+    WORD(12) = 0x5f5c803c;
+    WORD(16) = 0x5e544e81;
+    WORD(20) = 0x85335805;
+    WORD(24) = 0x94936767;
+    dest += 240;
+    HALF(8) = (HALF(8) & 0x00ff) | 0x8200;
+    HALF(10) = 0x8383;
+    WORD(12) = 0x5f4d7d4a;
+    WORD(16) = 0x60055734;
+    WORD(20) = 0x73890588;
+    HALF(24) = 0x6d8a;
+    HALF(26) = (HALF(26) & 0xff00) | 0x95;
+    dest += 240;
+    HALF(10) = (HALF(10) & 0x00ff) | 0x8400;
+    WORD(12) = 0x4e4e4876;
+    WORD(16) = 0x345f5050;
+    WORD(20) = 0x3c24255e;
+    HALF(24) = (HALF(24) & 0xff00) | 0x8b;
+    dest += 240;
+    HALF(12) = (HALF(12) & 0x00ff) | 0x9600;
+    HALF(14) = 0x9748;
+    WORD(16) = 0x61805c3c;
+    HALF(20) = 0x7f61;
+    HALF(22) = (HALF(22) & 0xff00) | 0x83;
+    dest += 240;
+    HALF(12) = (HALF(12) & 0x00ff) | 0x9800;
+    HALF(14) = 0x994f;
+    WORD(16) = 0x443d4f9a;
+    HALF(20) = 0x719b;
+    HALF(22) = (HALF(22) & 0xff00) | 0x9c;
+    /* 140 stores and 31 merges */
+}
+
+static void blit_bowl_0_2(volatile unsigned char* dest) {
+    dest += 720;
+    HALF(10) = 0x1413;
+    WORD(12) = 0x17051615;
+    WORD(16) = 0x24051918;
+    WORD(20) = 0x18261825;
+    WORD(24) = 0x2c2b270b;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x0100;
+    WORD(8) = 0x1a0a0302;
+    WORD(12) = 0x1c0b1b1b;
+    WORD(16) = 0x230b1c1c;
+    WORD(20) = 0x0b231c1c;
+    WORD(24) = 0x05292828;
+    HALF(28) = 0x2d05;
+    HALF(30) = (HALF(30) & 0xff00) | 0x2e;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x0400;
+    HALF(6) = 0x0605;
+    WORD(8) = 0x1e1d0807;
+    WORD(12) = 0x10101d1f;
+    WORD(16) = 0x10231010;
+    WORD(20) = 0x231c1c1c;
+    WORD(24) = 0x10151510;
+    WORD(28) = 0x30242f0b;
+    HALF(32) = (HALF(32) & 0xff00) | 0x31;
+    dest += 240;
+    WORD(4) = 0x0c0b0a09;
+    WORD(8) = 0x1e200e0d;
+    WORD(12) = 0x0b0b0c1e;
+    WORD(16) = 0x02210b21;
+    WORD(20) = 0x21022802;
+    WORD(24) = 0x28322828;
+    WORD(28) = 0x34332928;
+    HALF(32) = 0x0935;
+    dest += 240;
+    WORD(4) = 0x0c0b100f;
+    WORD(8) = 0x1b071211;
+    WORD(12) = 0x1c0b220c;
+    WORD(16) = 0x1010231c;
+    WORD(20) = 0x020b2315;
+    WORD(24) = 0x36342a29;
+    WORD(28) = 0x33383437;
+    HALF(32) = 0x0337;
+    dest += 240;
+    WORD(4) = 0x2222392f;
+    WORD(8) = 0x1e523b3a;
+    WORD(12) = 0x0b0b0c1d;
+    WORD(16) = 0x280b1023;
+    WORD(20) = 0x34386229;
+    WORD(24) = 0x38383834;
+    WORD(28) = 0x63343434;
+    HALF(32) = 0x6856;
+    dest += 240;
+    WORD(4) = 0x220c203c;
+    WORD(8) = 0x1d080d1d;
+    WORD(12) = 0x10100b22;
+    WORD(16) = 0x5729280b;
+    WORD(20) = 0x33336038;
+    WORD(24) = 0x38383833;
+    WORD(28) = 0x34343838;
+    HALF(32) = 0x6932;
+    dest += 240;
+    WORD(4) = 0x3f3a3e3d;
+    WORD(8) = 0x5311201f;
+    WORD(12) = 0x3e02101d;
+    WORD(16) = 0x38383833;
+    WORD(20) = 0x38383838;
+    WORD(24) = 0x6a383838;
+    WORD(28) = 0x0b296b38;
+    HALF(32) = 0x6c20;
+    dest += 240;
+    WORD(4) = 0x3e424140;
+    WORD(8) = 0x203f100b;
+    WORD(12) = 0x34383e10;
+    WORD(16) = 0x46375437;
+    WORD(20) = 0x63344646;
+    WORD(24) = 0x32623338;
+    WORD(28) = 0x22282323;
+    HALF(32) = 0x6d67;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x4300;
+    HALF(6) = 0x4544;
+    WORD(8) = 0x0b303446;
+    WORD(12) = 0x2832550b;
+    WORD(16) = 0x21210202;
+    WORD(20) = 0x28232323;
+    WORD(24) = 0x08100b28;
+    WORD(28) = 0x2524103b;
+    HALF(32) = 0x6e6c;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x4700;
+    HALF(6) = 0x4948;
+    WORD(8) = 0x564e4b4a;
+    WORD(12) = 0x59585757;
+    WORD(16) = 0x22225a59;
+    WORD(20) = 0x590c1d1d;
+    WORD(24) = 0x086f6419;
+    WORD(28) = 0x1a243070;
+    HALF(32) = (HALF(32) & 0xff00) | 0x71;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x4c00;
+    HALF(6) = 0x4d43;
+    WORD(8) = 0x5b454e49;
+    WORD(12) = 0x56465d5c;
+    WORD(16) = 0x65655e5e;
+    WORD(20) = 0x25256625;
+    WORD(24) = 0x08166060;
+    WORD(28) = 0x65256072;
+    HALF(32) = (HALF(32) & 0xff00) | 0x56;
+    dest += 240;
+    HALF(6) = 0x504f;
+    WORD(8) = 0x4e455051;
+    WORD(12) = 0x61605d5f;
+    WORD(16) = 0x0525055e;
+    WORD(20) = 0x25672525;
+    WORD(24) = 0x08105756;
+    WORD(28) = 0x74732402;
+    HALF(32) = (HALF(32) & 0xff00) | 0x2b;
+    dest += 240;
+    HALF(6) = 0x7675;
+    WORD(8) = 0x4e51474d;
+    WORD(12) = 0x36615f7d;
+    WORD(16) = 0x05050524;
+    WORD(20) = 0x57672525;
+    WORD(24) = 0x8c200556;
+    WORD(28) = 0x8e8d2505;
+    dest += 240;
+    HALF(6) = 0x4f77;
+    WORD(8) = 0x5047514b;
+    WORD(12) = 0x5f5f495b;
+    WORD(16) = 0x2525247e;
+    WORD(20) = 0x54856725;
+    WORD(24) = 0x238c5957;
+    WORD(28) = 0x908f6705;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x7800;
+    WORD(8) = 0x4747794f;
+    WORD(12) = 0x5f49495b;
+    WORD(16) = 0x25657e56;
+    WORD(20) = 0x38460567;
+    WORD(24) = 0x19093a86;
+    HALF(28) = 0x9125;
+    HALF(30) = (HALF(30) & 0xff00) | 0x24;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x7a00;
+    WORD(8) = 0x50474343;
+    WORD(12) = 0x7f50794b;
+    WORD(16) = 0x875e7e56;
+    WORD(20) = 0x592a3760;
+    WORD(24) = 0x916f1c59;
+    HALF(28) = 0x9267;
+    dest += 240;
+    WORD(8) = 0x494a767b;
+    WORD(12) = 0x7f5b5079;
+    WORD(16) = 0x3660605c;
+    WORD(20) = 0x29592454;
+    WORD(24) = 0x67251930;
+    HALF(28) = 0x2793;
+    dest += 240;
+    HALF(8) = (HALF(8) & 0x00ff) | 0x7c00;
+    HALF(10) = 0x794f;
+    WORD(12) = 0x5c803c4e;
+    WORD(16) = 0x544e815f;
+    WORD(20) = 0x3358055e;
+    WORD(24) = 0x93676785;
+    HALF(28) = (HALF(28) & 0xff00) | 0x94;
+    dest += 240;
+    HALF(10) = 0x8382;
+    WORD(12) = 0x4d7d4a83;
+    WORD(16) = 0x0557345f;
+    WORD(20) = 0x89058860;
+    WORD(24) = 0x956d8a73;
+    dest += 240;
+    WORD(12) = 0x4e487684;
+    WORD(16) = 0x5f50504e;
+    WORD(20) = 0x24255e34;
+    HALF(24) = 0x8b3c;
+    dest += 240;
+    HALF(14) = 0x4896;
+    WORD(16) = 0x805c3c97;
+    WORD(20) = 0x837f6161;
+    dest += 240;
+    HALF(14) = 0x4f98;
+    WORD(16) = 0x3d4f9a99;
+    WORD(20) = 0x9c719b44;
+    /* 147 stores and 15 merges */
+}
+
+static void blit_bowl_0_3(volatile unsigned char* dest) {
+    dest += 720;
+    HALF(10) = (HALF(10) & 0x00ff) | 0x1300;
+    WORD(12) = 0x05161514;
+    WORD(16) = 0x05191817;
+    WORD(20) = 0x26182524;
+    WORD(24) = 0x2b270b18;
+    HALF(28) = (HALF(28) & 0xff00) | 0x2c;
+    dest += 240;
+    WORD(8) = 0x0a030201;
+    WORD(12) = 0x0b1b1b1a;
+    WORD(16) = 0x0b1c1c1c;
+    WORD(20) = 0x231c1c23;
+    WORD(24) = 0x2928280b;
+    WORD(28) = 0x2e2d0505;
+    dest += 240;
+    HALF(6) = 0x0504;
+    WORD(8) = 0x1d080706;
+    WORD(12) = 0x101d1f1e;
+    WORD(16) = 0x23101010;
+    WORD(20) = 0x1c1c1c10;
+    WORD(24) = 0x15151023;
+    WORD(28) = 0x242f0b10;
+    HALF(32) = 0x3130;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x0900;
+    HALF(6) = 0x0b0a;
+    WORD(8) = 0x200e0d0c;
+    WORD(12) = 0x0b0c1e1e;
+    WORD(16) = 0x210b210b;
+    WORD(20) = 0x02280202;
+    WORD(24) = 0x32282821;
+    WORD(28) = 0x33292828;
+    HALF(32) = 0x3534;
+    HALF(34) = (HALF(34) & 0xff00) | 0x09;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x0f00;
+    HALF(6) = 0x0b10;
+    WORD(8) = 0x0712110c;
+    WORD(12) = 0x0b220c1b;
+    WORD(16) = 0x10231c1c;
+    WORD(20) = 0x0b231510;
+    WORD(24) = 0x342a2902;
+    WORD(28) = 0x38343736;
+    HALF(32) = 0x3733;
+    HALF(34) = (HALF(34) & 0xff00) | 0x03;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x2f00;
+    HALF(6) = 0x2239;
+    WORD(8) = 0x523b3a22;
+    WORD(12) = 0x0b0c1d1e;
+    WORD(16) = 0x0b10230b;
+    WORD(20) = 0x38622928;
+    WORD(24) = 0x38383434;
+    WORD(28) = 0x34343438;
+    HALF(32) = 0x5663;
+    HALF(34) = (HALF(34) & 0xff00) | 0x68;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x3c00;
+    HALF(6) = 0x0c20;
+    WORD(8) = 0x080d1d22;
+    WORD(12) = 0x100b221d;
+    WORD(16) = 0x29280b10;
+    WORD(20) = 0x33603857;
+    WORD(24) = 0x38383333;
+    WORD(28) = 0x34383838;
+    HALF(32) = 0x3234;
+    HALF(34) = (HALF(34) & 0xff00) | 0x69;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x3d00;
+    HALF(6) = 0x3a3e;
+    WORD(8) = 0x11201f3f;
+    WORD(12) = 0x02101d53;
+    WORD(16) = 0x3838333e;
+    WORD(20) = 0x38383838;
+    WORD(24) = 0x38383838;
+    WORD(28) = 0x296b386a;
+    HALF(32) = 0x200b;
+    HALF(34) = (HALF(34) & 0xff00) | 0x6c;
+    dest += 240;
+    HALF(4) = (HALF(4) & 0x00ff) | 0x4000;
+    HALF(6) = 0x4241;
+    WORD(8) = 0x3f100b3e;
+    WORD(12) = 0x383e1020;
+    WORD(16) = 0x37543734;
+    WORD(20) = 0x34464646;
+    WORD(24) = 0x62333863;
+    WORD(28) = 0x28232332;
+    HALF(32) = 0x6722;
+    HALF(34) = (HALF(34) & 0xff00) | 0x6d;
+    dest += 240;
+    HALF(6) = 0x4443;
+    WORD(8) = 0x30344645;
+    WORD(12) = 0x32550b0b;
+    WORD(16) = 0x21020228;
+    WORD(20) = 0x23232321;
+    WORD(24) = 0x100b2828;
+    WORD(28) = 0x24103b08;
+    HALF(32) = 0x6c25;
+    HALF(34) = (HALF(34) & 0xff00) | 0x6e;
+    dest += 240;
+    HALF(6) = 0x4847;
+    WORD(8) = 0x4e4b4a49;
+    WORD(12) = 0x58575756;
+    WORD(16) = 0x225a5959;
+    WORD(20) = 0x0c1d1d22;
+    WORD(24) = 0x6f641959;
+    WORD(28) = 0x24307008;
+    HALF(32) = 0x711a;
+    dest += 240;
+    HALF(6) = 0x434c;
+    WORD(8) = 0x454e494d;
+    WORD(12) = 0x465d5c5b;
+    WORD(16) = 0x655e5e56;
+    WORD(20) = 0x25662565;
+    WORD(24) = 0x16606025;
+    WORD(28) = 0x25607208;
+    HALF(32) = 0x5665;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x4f00;
+    WORD(8) = 0x45505150;
+    WORD(12) = 0x605d5f4e;
+    WORD(16) = 0x25055e61;
+    WORD(20) = 0x67252505;
+    WORD(24) = 0x10575625;
+    WORD(28) = 0x73240208;
+    HALF(32) = 0x2b74;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x7500;
+    WORD(8) = 0x51474d76;
+    WORD(12) = 0x615f7d4e;
+    WORD(16) = 0x05052436;
+    WORD(20) = 0x67252505;
+    WORD(24) = 0x20055657;
+    WORD(28) = 0x8d25058c;
+    HALF(32) = (HALF(32) & 0xff00) | 0x8e;
+    dest += 240;
+    HALF(6) = (HALF(6) & 0x00ff) | 0x7700;
+    WORD(8) = 0x47514b4f;
+    WORD(12) = 0x5f495b50;
+    WORD(16) = 0x25247e5f;
+    WORD(20) = 0x85672525;
+    WORD(24) = 0x8c595754;
+    WORD(28) = 0x8f670523;
+    HALF(32) = (HALF(32) & 0xff00) | 0x90;
+    dest += 240;
+    WORD(8) = 0x47794f78;
+    WORD(12) = 0x49495b47;
+    WORD(16) = 0x657e565f;
+    WORD(20) = 0x46056725;
+    WORD(24) = 0x093a8638;
+    WORD(28) = 0x24912519;
+    dest += 240;
+    WORD(8) = 0x4743437a;
+    WORD(12) = 0x50794b50;
+    WORD(16) = 0x5e7e567f;
+    WORD(20) = 0x2a376087;
+    WORD(24) = 0x6f1c5959;
+    HALF(28) = 0x6791;
+    HALF(30) = (HALF(30) & 0xff00) | 0x92;
+    dest += 240;
+    HALF(8) = (HALF(8) & 0x00ff) | 0x7b00;
+    HALF(10) = 0x4a76;
+    WORD(12) = 0x5b507949;
+    WORD(16) = 0x60605c7f;
+    WORD(20) = 0x59245436;
+    WORD(24) = 0x25193029;
+    HALF(28) = 0x9367;
+    HALF(30) = (HALF(30) & 0xff00) | 0x27;
+    dest += 240;
+    HALF(10) = 0x4f7c;
+    WORD(12) = 0x803c4e79;
+    WORD(16) = 0x4e815f5c;
+    WORD(20) = 0x58055e54;
+    WORD(24) = 0x67678533;
+    HALF(28) = 0x9493;
+    dest += 240;
+    HALF(10) = (HALF(10) & 0x00ff) | 0x8200;
+    WORD(12) = 0x7d4a8383;
+    WORD(16) = 0x57345f4d;
+    WORD(20) = 0x05886005;
+    WORD(24) = 0x6d8a7389;
+    HALF(28) = (HALF(28) & 0xff00) | 0x95;
+    dest += 240;
+    HALF(12) = (HALF(12) & 0x00ff) | 0x8400;
+    HALF(14) = 0x4876;
+    WORD(16) = 0x50504e4e;
+    WORD(20) = 0x255e345f;
+    HALF(24) = 0x3c24;
+    HALF(26) = (HALF(26) & 0xff00) | 0x8b;
+    dest += 240;
+    HALF(14) = (HALF(14) & 0x00ff) | 0x9600;
+    WORD(16) = 0x5c3c9748;
+    WORD(20) = 0x7f616180;
+    HALF(24) = (HALF(24) & 0xff00) | 0x83;
+    dest += 240;
+    HALF(14) = (HALF(14) & 0x00ff) | 0x9800;
+    WORD(16) = 0x4f9a994f;
+    WORD(20) = 0x719b443d;
+    HALF(24) = (HALF(24) & 0xff00) | 0x9c;
+    /* 145 stores and 31 merges */
+}
+
+/* object frame 0, 1024 opaque pixels */
+static const unsigned char object_0_pixels [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x03, 0x04, 0x06, 0x06, 0x06, 0x08, 0x08, 0x09, 0x08, 0x0a,
+    0x14, 0x04, 0x0f, 0x08, 0x18, 0x19, 0x1a, 0x1b, 0x22, 0x18, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x06, 0x0a, 0x06, 0x0b, 0x0b, 0x08, 0x0c, 0x0d, 0x0e,
+    0x04, 0x1c, 0x02, 0x0f, 0x0f, 0x08, 0x1d, 0x1e, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x0d, 0x04, 0x06, 0x03, 0x02, 0x0f, 0x10, 0x11,
+    0x17, 0x1f, 0x0a, 0x08, 0x1b, 0x1d, 0x20, 0x0f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x12, 0x13, 0x14, 0x04, 0x15, 0x16, 0x0a, 0x17,
+    0x0b, 0x06, 0x06, 0x1c, 0x14, 0x21, 0x1b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x23, 0x24, 0x08, 0x25, 0x15, 0x26, 0x27,
+    0x2d, 0x11, 0x10, 0x06, 0x11, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x28, 0x29, 0x08, 0x0c, 0x16, 0x06,
+    0x03, 0x2e, 0x0c, 0x17, 0x2f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2a, 0x24, 0x2b, 0x20, 0x2c,
+    0x0b, 0x30, 0x2e, 0x0a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+static void blit_object_0_0(volatile unsigned char* dest) {
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x04030201;
+    WORD(8) = 0x08060606;
+    WORD(12) = 0x0a080908;
+    WORD(16) = 0x080f0414;
+    WORD(20) = 0x1b1a1918;
+    WORD(24) = 0x01011822;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x06050101;
+    WORD(8) = 0x0b0b060a;
+    WORD(12) = 0x0e0d0c08;
+    WORD(16) = 0x0f021c04;
+    WORD(20) = 0x1e1d080f;
+    WORD(24) = 0x0101010c;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x07010101;
+    WORD(8) = 0x0306040d;
+    WORD(12) = 0x11100f02;
+    WORD(16) = 0x080a1f17;
+    WORD(20) = 0x0f201d1b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x04141312;
+    WORD(12) = 0x170a1615;
+    WORD(16) = 0x1c06060b;
+    WORD(20) = 0x011b2114;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x08242301;
+    WORD(12) = 0x27261525;
+    WORD(16) = 0x0610112d;
+    WORD(20) = 0x01010c11;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x29280101;
+    WORD(12) = 0x06160c08;
+    WORD(16) = 0x170c2e03;
+    WORD(20) = 0x0101012f;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x2a010101;
+    WORD(12) = 0x2c202b24;
+    WORD(16) = 0x0a2e300b;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    /* 256 stores and 0 merges */
+}
+
+static void blit_object_0_1(volatile unsigned char* dest) {
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x03020101;
+    WORD(8) = 0x06060604;
+    WORD(12) = 0x08090808;
+    WORD(16) = 0x0f04140a;
+    WORD(20) = 0x1a191808;
+    WORD(24) = 0x0118221b;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x05010101;
+    WORD(8) = 0x0b060a06;
+    WORD(12) = 0x0d0c080b;
+    WORD(16) = 0x021c040e;
+    WORD(20) = 0x1d080f0f;
+    WORD(24) = 0x01010c1e;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x06040d07;
+    WORD(12) = 0x100f0203;
+    WORD(16) = 0x0a1f1711;
+    WORD(20) = 0x201d1b08;
+    WORD(24) = 0x0101010f;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x14131201;
+    WORD(12) = 0x0a161504;
+    WORD(16) = 0x06060b17;
+    WORD(20) = 0x1b21141c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x24230101;
+    WORD(12) = 0x26152508;
+    WORD(16) = 0x10112d27;
+    WORD(20) = 0x010c1106;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x28010101;
+    WORD(12) = 0x160c0829;
+    WORD(16) = 0x0c2e0306;
+    WORD(20) = 0x01012f17;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x202b242a;
+    WORD(16) = 0x2e300b2c;
+    WORD(20) = 0x0101010a;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+static void blit_object_0_2(volatile unsigned char* dest) {
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x02010101;
+    WORD(8) = 0x06060403;
+    WORD(12) = 0x09080806;
+    WORD(16) = 0x04140a08;
+    WORD(20) = 0x1918080f;
+    WORD(24) = 0x18221b1a;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x060a0605;
+    WORD(12) = 0x0c080b0b;
+    WORD(16) = 0x1c040e0d;
+    WORD(20) = 0x080f0f02;
+    WORD(24) = 0x010c1e1d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x040d0701;
+    WORD(12) = 0x0f020306;
+    WORD(16) = 0x1f171110;
+    WORD(20) = 0x1d1b080a;
+    WORD(24) = 0x01010f20;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x13120101;
+    WORD(12) = 0x16150414;
+    WORD(16) = 0x060b170a;
+    WORD(20) = 0x21141c06;
+    WORD(24) = 0x0101011b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x23010101;
+    WORD(12) = 0x15250824;
+    WORD(16) = 0x112d2726;
+    WORD(20) = 0x0c110610;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x0c082928;
+    WORD(16) = 0x2e030616;
+    WORD(20) = 0x012f170c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x2b242a01;
+    WORD(16) = 0x300b2c20;
+    WORD(20) = 0x01010a2e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    /* 288 stores and 0 merges */
+}
+
+static void blit_object_0_3(volatile unsigned char* dest) {
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x06040302;
+    WORD(12) = 0x08080606;
+    WORD(16) = 0x140a0809;
+    WORD(20) = 0x18080f04;
+    WORD(24) = 0x221b1a19;
+    WORD(28) = 0x01010118;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x0a060501;
+    WORD(12) = 0x080b0b06;
+    WORD(16) = 0x040e0d0c;
+    WORD(20) = 0x0f0f021c;
+    WORD(24) = 0x0c1e1d08;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x0d070101;
+    WORD(12) = 0x02030604;
+    WORD(16) = 0x1711100f;
+    WORD(20) = 0x1b080a1f;
+    WORD(24) = 0x010f201d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x12010101;
+    WORD(12) = 0x15041413;
+    WORD(16) = 0x0b170a16;
+    WORD(20) = 0x141c0606;
+    WORD(24) = 0x01011b21;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x25082423;
+    WORD(16) = 0x2d272615;
+    WORD(20) = 0x11061011;
+    WORD(24) = 0x0101010c;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x08292801;
+    WORD(16) = 0x0306160c;
+    WORD(20) = 0x2f170c2e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x242a0101;
+    WORD(16) = 0x0b2c202b;
+    WORD(20) = 0x010a2e30;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+/* object frame 1, 1024 opaque pixels */
+static const unsigned char object_1_pixels [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x01, 0x31, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x31, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x31, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x32, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x34, 0x34, 0x01,
+    0x38, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x34, 0x01, 0x34, 0x34, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x35, 0x01, 0x01, 0x01, 0x01,
+    0x33, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x01, 0x01, 0x01, 0x01, 0x34, 0x37, 0x01,
+    0x34, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x01, 0x36, 0x34, 0x01, 0x34, 0x34, 0x01,
+    0x37, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x34, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x39, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x34, 0x36, 0x01, 0x34, 0x36,
+    0x01, 0x01, 0x35, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x01, 0x01, 0x34, 0x34,
+    0x36, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x36, 0x36, 0x01, 0x01, 0x01, 0x01, 0x36, 0x36,
+    0x01, 0x01, 0x36, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x01, 0x01, 0x36, 0x36, 0x01, 0x01, 0x01,
+    0x01, 0x36, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x36, 0x01, 0x34, 0x36,
+    0x01, 0x34, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x34, 0x34,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+static void blit_object_1_0(volatile unsigned char* dest) {
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01310101;
+    WORD(12) = 0x01010131;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x31010101;
+    WORD(12) = 0x01010131;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010131;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013201;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01343433;
+    WORD(16) = 0x01010138;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34340101;
+    WORD(12) = 0x01343401;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x35340101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013433;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010136;
+    WORD(12) = 0x01373401;
+    WORD(16) = 0x01013434;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34360134;
+    WORD(12) = 0x01343401;
+    WORD(16) = 0x01013437;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34340101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x39010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34340101;
+    WORD(12) = 0x36340136;
+    WORD(16) = 0x34350101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x36010101;
+    WORD(12) = 0x34340101;
+    WORD(16) = 0x01010136;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01013636;
+    WORD(12) = 0x36360101;
+    WORD(16) = 0x34360101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x36010134;
+    WORD(12) = 0x01010136;
+    WORD(16) = 0x01013601;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34010101;
+    WORD(12) = 0x36340136;
+    WORD(16) = 0x01013401;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x34340101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    /* 256 stores and 0 merges */
+}
+
+static void blit_object_1_1(volatile unsigned char* dest) {
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x31010101;
+    WORD(12) = 0x01013101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013131;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01320101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x34343301;
+    WORD(16) = 0x01013801;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34010101;
+    WORD(12) = 0x34340134;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34010101;
+    WORD(12) = 0x01010135;
+    WORD(16) = 0x01343301;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01013601;
+    WORD(12) = 0x37340101;
+    WORD(16) = 0x01343401;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x36013401;
+    WORD(12) = 0x34340134;
+    WORD(16) = 0x01343701;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34010101;
+    WORD(12) = 0x01010134;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010139;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34010101;
+    WORD(12) = 0x34013634;
+    WORD(16) = 0x35010136;
+    WORD(20) = 0x01010134;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x34010136;
+    WORD(16) = 0x01013634;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01363601;
+    WORD(12) = 0x36010101;
+    WORD(16) = 0x36010136;
+    WORD(20) = 0x01010134;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01013401;
+    WORD(12) = 0x01013636;
+    WORD(16) = 0x01360101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x34013634;
+    WORD(16) = 0x01340136;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x34010101;
+    WORD(16) = 0x01010134;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+static void blit_object_1_2(volatile unsigned char* dest) {
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01310131;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01313101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01310101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x32010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x34330101;
+    WORD(16) = 0x01380134;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x34013434;
+    WORD(16) = 0x01010134;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013534;
+    WORD(16) = 0x34330101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01360101;
+    WORD(12) = 0x34010101;
+    WORD(16) = 0x34340137;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01340101;
+    WORD(12) = 0x34013436;
+    WORD(16) = 0x34370134;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013434;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01013901;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01363434;
+    WORD(16) = 0x01013634;
+    WORD(20) = 0x01013435;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013601;
+    WORD(16) = 0x01363434;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x36360101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013636;
+    WORD(20) = 0x01013436;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01340101;
+    WORD(12) = 0x01363601;
+    WORD(16) = 0x36010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01363401;
+    WORD(16) = 0x34013634;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013434;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    /* 288 stores and 0 merges */
+}
+
+static void blit_object_1_3(volatile unsigned char* dest) {
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x31013101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x31310101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x31010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010132;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x33010101;
+    WORD(16) = 0x38013434;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01343401;
+    WORD(16) = 0x01013434;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01353401;
+    WORD(16) = 0x33010101;
+    WORD(20) = 0x01010134;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x36010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x34013734;
+    WORD(20) = 0x01010134;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34010101;
+    WORD(12) = 0x01343601;
+    WORD(16) = 0x37013434;
+    WORD(20) = 0x01010134;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01343401;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01390101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x36343401;
+    WORD(16) = 0x01363401;
+    WORD(20) = 0x01343501;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01360101;
+    WORD(16) = 0x36343401;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x36010101;
+    WORD(12) = 0x01010136;
+    WORD(16) = 0x01363601;
+    WORD(20) = 0x01343601;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x34010101;
+    WORD(12) = 0x36360101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010136;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x36340101;
+    WORD(16) = 0x01363401;
+    WORD(20) = 0x01010134;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01343401;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+/* object frame 2, 1024 opaque pixels */
+static const unsigned char object_2_pixels [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a,
+    0x01, 0x01, 0x01, 0x01, 0x3c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a,
+    0x01, 0x01, 0x01, 0x3c, 0x3c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a,
+    0x01, 0x01, 0x3c, 0x3c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x3c, 0x3c, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x01, 0x01, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+static void blit_object_2_0(volatile unsigned char* dest) {
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3a010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x0101013c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3a010101;
+    WORD(16) = 0x3c010101;
+    WORD(20) = 0x0101013c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3a010101;
+    WORD(16) = 0x3c3c0101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013c3c01;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b01;
+    WORD(16) = 0x3b01013b;
+    WORD(20) = 0x0101013b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b3b;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b3b;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b3b;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b3b;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b3b;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x01013b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x0101013b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x013b3b3b;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    /* 256 stores and 0 merges */
+}
+
+static void blit_object_2_1(volatile unsigned char* dest) {
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x0101013a;
+    WORD(20) = 0x01013c01;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x0101013a;
+    WORD(20) = 0x01013c3c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3c01013a;
+    WORD(20) = 0x0101013c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3c3c0101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b0101;
+    WORD(16) = 0x01013b3b;
+    WORD(20) = 0x01013b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b3b01;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x01013b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b01;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+static void blit_object_2_2(volatile unsigned char* dest) {
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013a01;
+    WORD(20) = 0x013c0101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013a01;
+    WORD(20) = 0x013c3c01;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013a01;
+    WORD(20) = 0x01013c3c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3c010101;
+    WORD(20) = 0x0101013c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b010101;
+    WORD(16) = 0x013b3b3b;
+    WORD(20) = 0x013b3b01;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b3b0101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b01;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x013b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b0101;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x0101013b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    /* 288 stores and 0 merges */
+}
+
+static void blit_object_2_3(volatile unsigned char* dest) {
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013a0101;
+    WORD(20) = 0x3c010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013a0101;
+    WORD(20) = 0x3c3c0101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013a0101;
+    WORD(20) = 0x013c3c01;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01013c3c;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b0101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b01;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x013b3b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x013b3b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x013b3b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3b010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01013b3b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b3b3b;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x0101013b;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b3b0101;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x3b3b3b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3b010101;
+    WORD(16) = 0x3b3b3b3b;
+    WORD(20) = 0x01013b3b;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+/* object frame 3, 1024 opaque pixels */
+static const unsigned char object_3_pixels [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d, 0x3d,
+    0x3d, 0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3d,
+    0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x3d, 0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x3d, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+static void blit_object_3_0(volatile unsigned char* dest) {
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x3d010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x013d0101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x013d0101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d0101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x013d3d01;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d0101;
+    WORD(12) = 0x01013d3d;
+    WORD(16) = 0x3d010101;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d0101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d01;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d0101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d3d01;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d3d01;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01013d3d;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x3d3d3d01;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x3d3d3d3d;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x3d3d0101;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d0101;
+    WORD(16) = 0x013d3d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d0101;
+    WORD(16) = 0x013d3d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d010101;
+    WORD(16) = 0x01013d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x0101013d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    /* 256 stores and 0 merges */
+}
+
+static void blit_object_3_1(volatile unsigned char* dest) {
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x3d010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x0101013d;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x3d3d0101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x013d3d3d;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d013d;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d0101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d0101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01013d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d3d01;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x013d3d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x3d3d0101;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x3d3d3d3d;
+    WORD(28) = 0x0101013d;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x3d010101;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d0101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x0101013d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d010101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d010101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013d3d3d;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013d3d01;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013d3d01;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01013d01;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+static void blit_object_3_2(volatile unsigned char* dest) {
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01013d01;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x0101013d;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013d3d;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x3d010101;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x3d3d3d01;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d013d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01013d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x013d3d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d0101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x3d3d3d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x3d010101;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x3d3d3d3d;
+    WORD(28) = 0x01013d3d;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01013d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d010101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x0101013d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x0101013d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d3d01;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d0101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d0101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x013d0101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    /* 288 stores and 0 merges */
+}
+
+static void blit_object_3_3(volatile unsigned char* dest) {
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x013d0101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01013d01;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01013d01;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x013d3d01;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01013d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x0101013d;
+    WORD(20) = 0x3d3d0101;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x013d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d0101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d0101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d0101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d0101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x0101013d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d01;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x01013d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x013d3d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x3d3d3d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d010101;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x3d3d3d3d;
+    WORD(28) = 0x0101013d;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d3d3d;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x3d3d3d3d;
+    WORD(28) = 0x013d3d3d;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3d3d3d01;
+    WORD(12) = 0x3d3d3d3d;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x3d3d3d3d;
+    WORD(24) = 0x013d3d3d;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d3d3d;
+    WORD(20) = 0x013d3d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d3d01;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d3d01;
+    WORD(20) = 0x01013d3d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d3d0101;
+    WORD(20) = 0x0101013d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d010101;
+    WORD(20) = 0x0101013d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d010101;
+    WORD(20) = 0x0101013d;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3d010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+/* object frame 4, 1024 opaque pixels */
+static const unsigned char object_4_pixels [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x3f, 0x01, 0x3e, 0x3e, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x01, 0x01, 0x3e, 0x3e, 0x3e, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x3e, 0x01, 0x01, 0x3e, 0x3e, 0x3f,
+    0x3e, 0x3e, 0x01, 0x01, 0x01, 0x01, 0x3a, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x3e, 0x3e, 0x01, 0x3e, 0x3e, 0x3e,
+    0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3f, 0x3e, 0x01, 0x01, 0x01, 0x3e,
+    0x3e, 0x3e, 0x3e, 0x3e, 0x3f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x3e, 0x3e, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3f,
+    0x3e, 0x3e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e, 0x3e,
+    0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x3e, 0x3e,
+    0x3e, 0x3e, 0x3f, 0x3e, 0x3e, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+static void blit_object_4_0(volatile unsigned char* dest) {
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x0101013a;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x0101013a;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x0101013f;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x3e010101;
+    WORD(8) = 0x3e013f3e;
+    WORD(12) = 0x0101013e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01013e3e;
+    WORD(12) = 0x013e3e3e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x3a010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x013e3e3e;
+    WORD(12) = 0x3f3e3e01;
+    WORD(16) = 0x01013e3e;
+    WORD(20) = 0x013a0101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e3e3e;
+    WORD(12) = 0x3e3e3e01;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x01013e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3f3e01;
+    WORD(12) = 0x3e010101;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x0101013f;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e3e01;
+    WORD(12) = 0x0101013e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e3e01;
+    WORD(12) = 0x013e3e3e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3f0101;
+    WORD(12) = 0x3f3e3e3e;
+    WORD(16) = 0x01013e3e;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e3e3e01;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x01013e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e3e0101;
+    WORD(16) = 0x3e3f3e3e;
+    WORD(20) = 0x0101013e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    dest += 240;
+    WORD(0) = 0x01010101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    /* 256 stores and 0 merges */
+}
+
+static void blit_object_4_1(volatile unsigned char* dest) {
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01013a01;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01013a01;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01013f01;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x013f3e3e;
+    WORD(12) = 0x01013e3e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x013e3e01;
+    WORD(12) = 0x3e3e3e01;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x0101013a;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e3e01;
+    WORD(12) = 0x3e3e0101;
+    WORD(16) = 0x013e3e3f;
+    WORD(20) = 0x3a010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e3e01;
+    WORD(12) = 0x3e3e013e;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x013e3e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3f3e0101;
+    WORD(12) = 0x0101013e;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x01013f3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e0101;
+    WORD(12) = 0x01013e3e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e0101;
+    WORD(12) = 0x3e3e3e3e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3f010101;
+    WORD(12) = 0x3e3e3e3e;
+    WORD(16) = 0x013e3e3f;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e3e0101;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x013e3e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e010101;
+    WORD(16) = 0x3f3e3e3e;
+    WORD(20) = 0x01013e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(0) = (HALF(0) & 0x00ff) | 0x0100;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = (HALF(32) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+static void blit_object_4_2(volatile unsigned char* dest) {
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x013a0101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x013a0101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x013f0101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3f3e3e01;
+    WORD(12) = 0x013e3e01;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e0101;
+    WORD(12) = 0x3e3e0101;
+    WORD(16) = 0x0101013e;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01013a01;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e0101;
+    WORD(12) = 0x3e01013e;
+    WORD(16) = 0x3e3e3f3e;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x0101013a;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e0101;
+    WORD(12) = 0x3e013e3e;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x3e3e3e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e010101;
+    WORD(12) = 0x01013e3f;
+    WORD(16) = 0x3e3e3e01;
+    WORD(20) = 0x013f3e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e010101;
+    WORD(12) = 0x013e3e3e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e010101;
+    WORD(12) = 0x3e3e3e3e;
+    WORD(16) = 0x0101013e;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e3e3e3f;
+    WORD(16) = 0x3e3e3f3e;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e010101;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x3e3e3e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x013e3e3f;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    dest += 240;
+    HALF(2) = 0x0101;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    /* 288 stores and 0 merges */
+}
+
+static void blit_object_4_3(volatile unsigned char* dest) {
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3a010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3a010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3f010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e3e0101;
+    WORD(12) = 0x3e3e013f;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e010101;
+    WORD(12) = 0x3e01013e;
+    WORD(16) = 0x01013e3e;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x013a0101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e010101;
+    WORD(12) = 0x01013e3e;
+    WORD(16) = 0x3e3f3e3e;
+    WORD(20) = 0x0101013e;
+    WORD(24) = 0x01013a01;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x3e010101;
+    WORD(12) = 0x013e3e3e;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x3e3e3e3e;
+    WORD(24) = 0x0101013e;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x013e3f3e;
+    WORD(16) = 0x3e3e0101;
+    WORD(20) = 0x3f3e3e3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e3e3e3e;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e3e3e3e;
+    WORD(16) = 0x01013e3e;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x3e3e3f01;
+    WORD(16) = 0x3e3f3e3e;
+    WORD(20) = 0x0101013e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3e3e3e3e;
+    WORD(20) = 0x3e3e3e3e;
+    WORD(24) = 0x0101013e;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x3e3e3e01;
+    WORD(20) = 0x3e3e3f3e;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    dest += 240;
+    HALF(2) = (HALF(2) & 0x00ff) | 0x0100;
+    WORD(4) = 0x01010101;
+    WORD(8) = 0x01010101;
+    WORD(12) = 0x01010101;
+    WORD(16) = 0x01010101;
+    WORD(20) = 0x01010101;
+    WORD(24) = 0x01010101;
+    WORD(28) = 0x01010101;
+    HALF(32) = 0x0101;
+    HALF(34) = (HALF(34) & 0xff00) | 0x01;
+    /* 256 stores and 64 merges */
+}
+
+const struct CompiledSprite bowl_sprites [] = {
+    {32, 32, bowl_0_pixels, {blit_bowl_0_0, blit_bowl_0_1, blit_bowl_0_2, blit_bowl_0_3}},
+};
+
+const struct CompiledSprite object_sprites [] = {
+    {32, 32, object_0_pixels, {blit_object_0_0, blit_object_0_1, blit_object_0_2, blit_object_0_3}},
+    {32, 32, object_1_pixels, {blit_object_1_0, blit_object_1_1, blit_object_1_2, blit_object_1_3}},
+    {32, 32, object_2_pixels, {blit_object_2_0, blit_object_2_1, blit_object_2_2, blit_object_2_3}},
+    {32, 32, object_3_pixels, {blit_object_3_0, blit_object_3_1, blit_object_3_2, blit_object_3_3}},
+    {32, 32, object_4_pixels, {blit_object_4_0, blit_object_4_1, blit_object_4_2, blit_object_4_3}},
+};
+
+#undef HALF
+#undef WORD
@@ -0,0 +1,185 @@
+/*
+ * fx.c
+ * the display effects
+ */
+
+#include "gba.h"
+#include "fx.h"
+
+/* the blend modes in the blend control register */
+#define BLEND_OFF (0 << 6)
+#define BLEND_ALPHA (1 << 6)
+#define BLEND_WHITE (2 << 6)
+#define BLEND_BLACK (3 << 6)
+
+/* the copies of the registers which fx_apply writes */
+static unsigned short fx_blend_control = 0;
+static unsigned short fx_blend_alpha = 0;
+static unsigned short fx_blend_fade = 0;
+static unsigned short fx_horizontal[2];
+static unsigned short fx_vertical[2];
+static unsigned short fx_inside = 0;
+static unsigned short fx_outside = 0;
+static unsigned int fx_windows = 0;
+
+/* which of the copies have changed since they were last written, so a
+ * frame of a fade only writes the fade level */
+#define DIRTY_BLEND 0x1
+#define DIRTY_FADE 0x2
+#define DIRTY_WINDOWS 0x4
+static int fx_dirty = 0;
+
+/* the alpha blending to put back after a fade */
+static unsigned short fx_alpha_control = BLEND_OFF;
+
+/* the fade level in 8.8 out of 16, the level the fade ends on, how much it
+ * changes each frame and the frames left */
+static int fx_level = 0;
+static int fx_target = 0;
+static int fx_step = 0;
+static int fx_frames = 0;
+
+/* turn off every effect */
+void fx_init() {
+    fx_blend_control = BLEND_OFF;
+    fx_alpha_control = BLEND_OFF;
+    fx_blend_alpha = 0;
+    fx_blend_fade = 0;
+    fx_inside = 0;
+    fx_outside = 0;
+    fx_windows = 0;
+    fx_level = 0;
+    fx_target = 0;
+    fx_frames = 0;
+    fx_dirty = DIRTY_BLEND | DIRTY_FADE | DIRTY_WINDOWS;
+    fx_apply();
+}
+
+/* blend layers over the ones underneath them */
+void fx_alpha(int top, int bottom, int top_weight, int bottom_weight) {
+    fx_alpha_control = top | BLEND_ALPHA | (bottom << 8);
+    fx_blend_alpha = top_weight | (bottom_weight << 8);
+    if (fx_frames == 0 && fx_level == 0) {
+        fx_blend_control = fx_alpha_control;
+    }
+    fx_dirty |= DIRTY_BLEND;
+}
+
+/* stop blending */
+void fx_alpha_off() {
+    fx_alpha_control = BLEND_OFF;
+    if (fx_frames == 0 && fx_level == 0) {
+        fx_blend_control = BLEND_OFF;
+        fx_dirty |= DIRTY_BLEND;
+    }
+}
+
+/* start a fade from the current level to a new one, the step is worked out
+ * once here so each frame is just an add */
+static void fx_fade(int layers, enum FxFade fade, int frames, int target) {
+    if (frames < 1) {
+        frames = 1;
+    }
+    fx_blend_control = layers | (fade == FX_TO_WHITE ? BLEND_WHITE : BLEND_BLACK);
+    fx_target = target << 8;
+    fx_step = (fx_target - fx_level) / frames;
+    fx_frames = frames;
+    fx_dirty |= DIRTY_BLEND;
+}
+
+/* fade layers out */
+void fx_fade_out(int layers, enum FxFade fade, int frames) {
+    fx_fade(layers, fade, frames, 16);
+}
+
+/* fade layers back in */
+void fx_fade_in(int layers, enum FxFade fade, int frames) {
+    if (fx_level == 0 && fx_frames == 0) {
+        /* fading in from nothing starts all the way out */
+        fx_level = 16 << 8;
+        fx_blend_fade = 16;
+        fx_dirty |= DIRTY_FADE;
+    }
+    fx_fade(layers, fade, frames, 0);
+}
+
+/* whether a fade is still going */
+int fx_fading() {
+    return fx_frames != 0;
+}
+
+/* set a window to a rectangle */
+void fx_window(int window, int x1, int y1, int x2, int y2, int layers) {
+    fx_horizontal[window] = (x1 << 8) | x2;
+    fx_vertical[window] = (y1 << 8) | y2;
+
+    /* window 0 has the low byte of the inside register and 1 the high */
+    int shift = window * 8;
+    fx_inside = (fx_inside & ~(0xff << shift)) | (layers << shift);
+    fx_windows |= window == 0 ? WIN0_ENABLE : WIN1_ENABLE;
+    fx_dirty |= DIRTY_WINDOWS;
+}
+
+/* turn a window off */
+void fx_window_off(int window) {
+    fx_windows &= ~(window == 0 ? WIN0_ENABLE : WIN1_ENABLE);
+    fx_dirty |= DIRTY_WINDOWS;
+}
+
+/* the layers which show outside of all the windows */
+void fx_window_outside(int layers) {
+    fx_outside = layers;
+    fx_dirty |= DIRTY_WINDOWS;
+}
+
+/* advance a fade by one frame */
+void fx_update() {
+    if (fx_frames == 0) {
+        return;
+    }
+
+    fx_level += fx_step;
+    fx_frames--;
+    if (fx_frames == 0) {
+        /* land exactly on the end, and once faded all the way in put the
+         * alpha blending back */
+        fx_level = fx_target;
+        if (fx_level == 0) {
+            fx_blend_control = fx_alpha_control;
+            fx_dirty |= DIRTY_BLEND;
+        }
+    }
+
+    /* the level only changes the register once every few frames on a slow
+     * fade */
+    if (fx_blend_fade != (fx_level >> 8)) {
+        fx_blend_fade = fx_level >> 8;
+        fx_dirty |= DIRTY_FADE;
+    }
+}
+
+/* write the effects to the registers */
+void fx_apply() {
+    if (fx_dirty & DIRTY_BLEND) {
+        *blend_control = fx_blend_control;
+        *blend_alpha = fx_blend_alpha;
+    }
+    if (fx_dirty & DIRTY_FADE) {
+        *blend_fade = fx_blend_fade;
+    }
+    if (fx_dirty & DIRTY_WINDOWS) {
+        *window0_horizontal = fx_horizontal[0];
+        *window0_vertical = fx_vertical[0];
+        *window1_horizontal = fx_horizontal[1];
+        *window1_vertical = fx_vertical[1];
+        *window_inside = fx_inside;
+        *window_outside = fx_outside;
+        *display_control = (*display_control & ~(WIN0_ENABLE | WIN1_ENABLE)) | fx_windows;
+    }
+    fx_dirty = 0;
+}
+
+/* the vblank task which writes the effects to the registers */
+void fx_task(void* data) {
+    fx_apply();
+}
@@ -0,0 +1,69 @@
+/*
+ * fx.h
+ * the display effects, fades, blending layers together and windows, done
+ * with the blending and window registers so a fade costs a register write
+ * a frame rather than rewriting the palette
+ *
+ * the effects are kept in copies of the registers and written by fx_apply
+ * or fx_task during vblank
+ */
+
+#ifndef FX_H
+#define FX_H
+
+/* the layers, as the bits the blending and window registers use */
+#define FX_BG0 0x01
+#define FX_BG1 0x02
+#define FX_BG2 0x04
+#define FX_BG3 0x08
+#define FX_SPRITES 0x10
+#define FX_BACKDROP 0x20
+#define FX_ALL 0x3f
+
+/* in the window registers the sixth bit turns blending on and off */
+#define FX_BLEND 0x20
+
+/* the ways the screen can be faded */
+enum FxFade {
+    FX_TO_BLACK,
+    FX_TO_WHITE
+};
+
+/* turn off every effect */
+void fx_init();
+
+/* blend layers over the ones underneath them, with weights out of 16, the
+ * top layers show through the bottom ones where they overlap */
+void fx_alpha(int top, int bottom, int top_weight, int bottom_weight);
+
+/* stop blending */
+void fx_alpha_off();
+
+/* fade layers out to black or white, or back in from it, over a number of
+ * frames, any alpha blending is put back once a fade in finishes */
+void fx_fade_out(int layers, enum FxFade fade, int frames);
+void fx_fade_in(int layers, enum FxFade fade, int frames);
+
+/* whether a fade is still going */
+int fx_fading();
+
+/* set window 0 or 1 to a rectangle, showing the given layers inside it,
+ * the edges are inclusive of x1, y1 and exclusive of x2, y2 */
+void fx_window(int window, int x1, int y1, int x2, int y2, int layers);
+
+/* turn a window off */
+void fx_window_off(int window);
+
+/* the layers which show outside of all the windows */
+void fx_window_outside(int layers);
+
+/* advance a fade by one frame */
+void fx_update();
+
+/* write the effects to the registers, this goes in vblank */
+void fx_apply();
+
+/* the vblank task which writes the effects to the registers */
+void fx_task(void* data);
+
+#endif
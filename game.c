@@ -1,5 +1,17 @@
 /* simple catcher game for the GBA*/
-#include "background.h"
+#include "gba.h"
+#include "input.h"
+#include "profile.h"
+#include "vblank.h"
+#include "layer.h"
+#include "bitmap.h"
+#include "fx.h"
+#include "save.h"
+#include "music.h"
+#include "theme.h"
+#include "text.h"
+#include "vwf.h"
+#include "bg.h"
 #include "map.h"
 #include "map2.h"
 #include "bowl2.h"
@@ -8,101 +20,8 @@
 #define WIDTH 240
 #define HEIGHT 160
 
-/* these identifiers define different bit positions of the display control */
-#define MODE4 0x0004
-#define BG2 0x0400
-
-/* the three tile modes */
-#define MODE0 0x00
-#define MODE1 0x01
-#define MODE2 0x02
-
-/* enable bits for the four tile layers */
-#define BG0_ENABLE 0x100
-#define BG1_ENABLE 0x200
-#define BG2_ENABLE 0x400
-#define BG3_ENABLE 0x800
-
-/* the control registers for the four tile layers */
-volatile unsigned short* bg0_control = (volatile unsigned short*) 0x4000008;
-volatile unsigned short* bg1_control = (volatile unsigned short*) 0x400000a;
-volatile unsigned short* bg2_control = (volatile unsigned short*) 0x400000c;
-volatile unsigned short* bg3_control = (volatile unsigned short*) 0x400000e;
-
-/* palette is always 256 colors */
-#define PALETTE_SIZE 256
-
-
-/* this bit indicates whether to display the front or the back buffer
- * this allows us to refer to bit 4 of the display_control register */
-#define SHOW_BACK 0x10
-
-/* the screen is simply a pointer into memory at a specific address this
- *  * pointer points to 16-bit colors of which there are 240x160 */
-volatile unsigned short* screen = (volatile unsigned short*) 0x6000000;
-
-/* the display control pointer points to the gba graphics register */
-volatile unsigned long* display_control = (volatile unsigned long*) 0x4000000;
-
 /* the address of the color palette used in graphics mode 4 */
-volatile unsigned short* palette = (volatile unsigned short*) 0x5000000;
-
-/* pointers to the front and back buffers - the front buffer is the start
- * of the screen array and the back buffer is a pointer to the second half */
-volatile unsigned short* front_buffer = (volatile unsigned short*) 0x6000000;
-volatile unsigned short* back_buffer = (volatile unsigned short*)  0x600A000;
-
-/* the button register holds the bits which indicate whether each button has
- * been pressed - this has got to be volatile as well
- */
-volatile unsigned short* buttons = (volatile unsigned short*) 0x04000130;
-
-/* scrolling registers for backgrounds */
-volatile short* bg0_x_scroll = (unsigned short*) 0x4000010;
-volatile short* bg0_y_scroll = (unsigned short*) 0x4000012;
-volatile short* bg1_x_scroll = (unsigned short*) 0x4000014;
-volatile short* bg1_y_scroll = (unsigned short*) 0x4000016;
-volatile short* bg2_x_scroll = (unsigned short*) 0x4000018;
-volatile short* bg2_y_scroll = (unsigned short*) 0x400001a;
-volatile short* bg3_x_scroll = (unsigned short*) 0x400001c;
-volatile short* bg3_y_scroll = (unsigned short*) 0x400001e;
-
-/* the bit positions indicate each button - the first bit is for A, second for
- * B, and so on, each constant below can be ANDED into the register to get the
- * status of any one button */
-#define BUTTON_A (1 << 0)
-#define BUTTON_B (1 << 1)
-#define BUTTON_SELECT (1 << 2)
-#define BUTTON_START (1 << 3)
-#define BUTTON_RIGHT (1 << 4)
-#define BUTTON_LEFT (1 << 5)
-#define BUTTON_UP (1 << 6)
-#define BUTTON_DOWN (1 << 7)
-#define BUTTON_R (1 << 8)
-#define BUTTON_L (1 << 9)
-
-/* the scanline counter is a memory cell which is updated to indicate how
- * much of the screen has been drawn */
-volatile unsigned short* scanline_counter = (volatile unsigned short*) 0x4000006;
-
-/* wait for the screen to be fully drawn so we can do something during vblank */
-void wait_vblank() {
-    /* wait until all 160 lines have been updated */
-    while (*scanline_counter < 160) { }
-}
-
-/* this function checks whether a particular button has been pressed */
-unsigned char button_pressed(unsigned short button) {
-    /* and the button register with the button constant we want */
-    unsigned short pressed = *buttons & button;
-
-    /* if this value is zero, then it's not pressed */
-    if (pressed == 0) {
-        return 1;
-    } else {
-        return 0;
-    }
-}
+volatile unsigned short* palette = (volatile unsigned short*) MEM_PALETTE(0x000);
 
 /* keep track of the next palette index */
 int next_palette_index = 0;
@@ -126,14 +45,16 @@ unsigned char add_color(unsigned char r, unsigned char g, unsigned char b) {
     return next_palette_index - 1;
 }
 
-/* a colored square */
+/* a colored square, which can hang off any edge of the screen */
 struct square {
-    unsigned short x, y, size;
+    short x, y;
+    unsigned short size;
     unsigned char color;
 };
 
-/* put a pixel on the screen in mode 4 */
-void put_pixel(volatile unsigned short* buffer, int row, int col, unsigned char color) {
+/* put a pixel on the screen in mode 4, the row and column must be on the
+ * screen */
+IWRAM_CODE void put_pixel(volatile unsigned short* buffer, int row, int col, unsigned char color) {
     /* find the offset which is the regular offset divided by two */
     unsigned short offset = (row * WIDTH + col) >> 1;
 
@@ -150,27 +71,23 @@ void put_pixel(volatile unsigned short* buffer, int row, int col, unsigned char
     }
 }
 
-/* draw a square onto the screen */
+/* the mode 4 page a buffer is, for the bitmap drawing */
+struct Bitmap page_bitmap(volatile unsigned short* buffer) {
+    struct Bitmap page = {buffer, WIDTH, HEIGHT, WIDTH / 2, 8};
+    return page;
+}
+
+/* draw a square onto the screen, the part of it off the screen is clipped
+ * off once rather than checking every pixel */
 void draw_square(volatile unsigned short* buffer, struct square* s) {
-    short row, col;
-    /* for each row of the square */
-    for (row = s->y; row < (s->y + s->size); row++) {
-        /* loop through each column of the square */
-        for (col = s->x; col < (s->x + s->size); col++) {
-            /* set the screen location to this color */
-            put_pixel(buffer, row, col, s->color);
-        }
-    }
+    struct Bitmap page = page_bitmap(buffer);
+    bitmap_rect(&page, s->x, s->y, s->size, s->size, s->color);
 }
 
-/* clear the screen right around the square */
+/* clear the screen right around the square, which can go off the edges */
 void update_screen(volatile unsigned short* buffer, unsigned short color, struct square* s) {
-    short row, col;
-    for (row = s->y - 3; row < (s->y + s->size + 3); row++) {
-        for (col = s->x - 3; col < (s->x + s->size + 3); col++) {
-            put_pixel(buffer, row, col, color);
-        }
-    }
+    struct Bitmap page = page_bitmap(buffer);
+    bitmap_rect(&page, s->x - 3, s->y - 3, s->size + 6, s->size + 6, color);
 }
 
 /* this function takes a video buffer and returns to you the other one */
@@ -206,87 +123,84 @@ void handle_buttons(struct square* s) {
 
 /* clear the screen to black */
 void clear_screen(volatile unsigned short* buffer, unsigned short color) {
-    unsigned short row, col;
-    /* set each pixel black */
-    for (row = 0; row < HEIGHT; row++) {
-        for (col = 0; col < WIDTH; col++) {
-            put_pixel(buffer, row, col, color);
-        }
-    }
-}
-/* return a pointer to one of the 4 character blocks (0-3) */
-volatile unsigned short* char_block(unsigned long block) {
-    /* they are each 16K big */
-    return (volatile unsigned short*) (0x6000000 + (block * 0x4000));
-}
-/* return a pointer to one of the 32 screen blocks (0-31) */
-volatile unsigned short* screen_block(unsigned long block) {
-    /* they are each 2K big */
-    return (volatile unsigned short*) (0x6000000 + (block * 0x800));
+    struct Bitmap page = page_bitmap(buffer);
+    bitmap_rect(&page, 0, 0, WIDTH, HEIGHT, color);
 }
 
-/* function to setup background 0 for this program */
-void setup_background() {
+/* the tiles both layers are made from */
+const struct Tileset bg_tileset = {
+    bg_data, bg_width * bg_height, bg_palette, 256
+};
 
-    /* load the palette from the image into palette memory*/
-    for (int i = 0; i < PALETTE_SIZE; i++) {
-        palette[i] = background_palette[i];
-    }
+/* the background, in screen block 16 */
+const struct Layer background = {
+    0,                      /* the layer */
+    &bg_tileset, map, map_width, map_height,
+    0,                      /* palette bank */
+    0, 16,                  /* char and screen block */
+    1,                      /* priority */
+    LAYER_256_256
+};
 
-    /* load the image into char block 0 (16 bits at a time) */
-    volatile unsigned short* dest = char_block(0);
-    unsigned short* image = (unsigned short*) background_data;
-    for (int i = 0; i < ((background_width * background_height) / 2); i++) {
-        dest[i] = image[i];
-    }
+/* the overlay in front of it, which shares its tiles, in screen block 17 */
+const struct Layer overlay = {
+    1,
+    &bg_tileset, map2, map2_width, map2_height,
+    0,
+    0, 17,
+    0,
+    LAYER_256_256
+};
+
+/* the score along the top, on bg2 with the font in char block 3, which the
+ * background's tiles do not reach, and its map in screen block 31 */
+const struct TextLayer hud = {
+    2,                      /* the layer */
+    3, 31,                  /* char and screen block */
+    15, 0x7fff,             /* palette bank and color */
+    0                       /* priority */
+};
+
+/* the line of variable width text above the score */
+struct VwfBox message = {
+    1, 0,                   /* position */
+    28, 1,                  /* width and lines */
+    1                       /* color */
+};
+
+/* the buttons pressed this run, kept if it makes the best score */
+struct SaveReplay run_replay;
+
+/* set when the settings have changed since the record was last written */
+int settings_changed = 0;
 
-    /* set all control the bits in this register */
-    *bg0_control = 1 |    /* priority, 0 is highest, 3 is lowest */
-        (0 << 2)  |       /* the char block the image data is stored in */
-        (0 << 6)  |       /* the mosaic flag */
-        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
-        (16 << 8) |       /* the screen block the tile data is stored in */
-        (1 << 13) |       /* wrapping flag */
-        (0 << 14);        /* bg size, 0 is 256x256 */
-
-    /* load the tile data into screen block 16 */
-    dest = screen_block(16);
-    for (int i = 0; i < (map_width * map_height); i++) {
-        dest[i] = map[i];
+/* finish a run, its score goes in the table and its replay is kept if it
+ * is the best, and the record is started writing out if that or the
+ * settings changed anything */
+void end_run(unsigned int score) {
+    int place = save_add_score(score, "YOU");
+    if (place == 0) {
+        save_record.replay = run_replay;
+    }
+    if (place >= 0 || settings_changed) {
+        save_commit();
+        settings_changed = 0;
     }
-}
 
- /* function to setup background 0 for this program */
-void setup_overlay() {
-
-     /* load the palette from the image into palette memory*/
-     for (int i = 0; i < PALETTE_SIZE; i++) {
-         palette[i] = background_palette[i];
-     }
-
-     /* load the image into char block 0 (16 bits at a time) */
-     volatile unsigned short* dest = char_block(0);
-     unsigned short* image = (unsigned short*) background_data;
-     for (int i = 0; i < ((background_width * background_height) / 2); i++) {
-         dest[i] = image[i];
-     }
-
-     /* set all control the bits in new register for map 2 */
-       *bg1_control = 0 |   /* new register */
-          (0 << 2)  |
-          (0 << 6)  |
-          (1 << 7)  |
-          (17 << 8) |       /* new screen block the tile data is stored in */
-          (1 << 13) |
-          (0 << 14);
-     
-    /* load the tile data into screen block 17 */
-      dest = screen_block(17);
-      for (int i = 0; i < (map2_width * map2_height); i++) {
-         dest[i] = map2[i];
-     }
+    run_replay.frames = 0;
+    run_replay.runs = 0;
 }
 
+/* L and R turn the music down and up, which is kept in the settings */
+void change_volume(int step) {
+    int volume = save_record.settings.music_volume + step;
+    if (volume < 0 || volume > 16) {
+        return;
+    }
+    save_record.settings.music_volume = volume;
+    music_volume(volume);
+    settings_changed = 1;
+}
 
 /* just kill time */
 void delay(unsigned int amount) {
@@ -296,31 +210,146 @@ void delay(unsigned int amount) {
 /* the main function */
 int main() {
     /* we set the mode to mode 4 with bg2 on */
-    *display_control = MODE0 | BG0_ENABLE | BG1_ENABLE;
+    *display_control = MODE0 | BG0_ENABLE | BG1_ENABLE | BG2_ENABLE;
 
     /* setup the background and overlay */
-    setup_background();
-    setup_overlay();
+    layer_reset();
+    layer_load(&background);
+    layer_load(&overlay);
+
+    /* the overlay is see through, the strip along the top is kept clear of
+     * it for the score, and the level fades in from black, the strip too
+     * since blending is turned on in it */
+    fx_init();
+    fx_alpha(FX_BG1, FX_BG0 | FX_BACKDROP, 10, 6);
+    fx_window(0, 0, 0, WIDTH, 16, FX_BG0 | FX_BG2 | FX_BLEND);
+    fx_window_outside(FX_ALL);
+    fx_fade_in(FX_ALL, FX_TO_BLACK, 32);
+    fx_apply();
+
+    /* load the high scores and put the best one up with the score */
+    save_init();
+    int hud_shown = text_init(&hud);
+    if (hud_shown) {
+        text_print(1, 1, "SCORE");
+        text_print(19, 1, "BEST");
+        text_print_number(24, 1, save_record.scores[0].score, 5);
+    }
+
+    /* the message takes its tiles from the HUD's char block, so without
+     * the HUD there is no message either */
+    int message_shown = hud_shown && vwf_init(&message);
 
-    /* set initial scroll to 0 */
+    /* start the music as loud as the settings say */
+    music_init();
+    music_volume(save_record.settings.music_volume);
+    music_play(&theme);
+
+    /* set initial scroll to 0, the score is how far right the player gets */
     int xscroll = 0;
     int x1scroll = 0;
+    int score = 0;
+
+    /* the buttons down last frame, so a press is only acted on once */
+    unsigned short held = 0;
+
+    /* set while the record is being written between runs */
+    int saving = 0;
+
+    /* choose between the keypad and a recorded session */
+    input_init();
+
+    /* start timing the frames */
+    profile_init();
+
+    /* loop until the input runs out, which is never on the hardware */
+    while (input_poll()) {
+        unsigned short pressed = input_buttons() & ~held;
+        held = input_buttons();
+
+        profile_begin(PROFILE_FRAME);
+
+        if (saving) {
+            /* between runs the level stands still while the record is
+             * written a piece at a time, since Flash can stall for
+             * milliseconds */
+            saving = save_step(SAVE_STEP_BYTES);
+            if (message_shown) {
+                vwf_print(&message, 0, "Saving...");
+            }
+        } else {
+            /* start ends the run, and the next one begins from the start
+             * once the save is done */
+            if (pressed & BUTTON_START) {
+                end_run(score);
+                saving = 1;
+                score = 0;
+                xscroll = 0;
+                if (hud_shown) {
+                    text_print_number(24, 1, save_record.scores[0].score, 5);
+                }
+            }
+            if (pressed & BUTTON_L) {
+                change_volume(-1);
+            }
+            if (pressed & BUTTON_R) {
+                change_volume(1);
+            }
+
+            if (button_pressed(BUTTON_RIGHT)) {
+                xscroll++;
+            }
+            if (button_pressed(BUTTON_LEFT)) {
+                xscroll--;
+            }
+            if (xscroll > score) {
+                score = xscroll;
+            }
+            if (hud_shown) {
+                text_print_number(7, 1, score, 5);
+            }
+            if (message_shown) {
+                if (score > save_record.scores[0].score) {
+                    vwf_print(&message, 0, "That's a new best score, keep going!");
+                } else {
+                    vwf_print(&message, 0, "Scroll right as far as you can.");
+                }
+            }
+            save_replay_add(&run_replay, input_buttons());
+        }
+        fx_update();
+        music_update();
 
-    /* loop forever */
-    while (1) {
-        if (button_pressed(BUTTON_RIGHT)) {
-            xscroll++;
+        /* queue up the changed cells of the HUD and the message's newly
+         * drawn tiles for vblank */
+        if (hud_shown && text_pending()) {
+            vblank_add(text_task, 0, text_pending(), VBLANK_CRITICAL);
         }
-        if (button_pressed(BUTTON_LEFT)) {
-            xscroll--;
+        if (message_shown && vwf_pending(&message)) {
+            vblank_add(vwf_task, &message, vwf_pending(&message), VBLANK_CRITICAL);
         }
+        profile_end(PROFILE_FRAME);
 
         /* wiat for vblank before switching buffers */
         wait_vblank();
         *bg0_x_scroll = xscroll;
         *bg1_x_scroll = x1scroll;
+        fx_apply();
+        profile_begin(PROFILE_VBLANK);
+        vblank_run();
+        profile_end(PROFILE_VBLANK);
+        profile_frame();
 
         /* delay some */
         delay(50);
     }
+
+    /* the host's input has run out, which ends the run, and the save can
+     * take as many frames as it needs */
+    end_run(score);
+    while (save_step(SAVE_STEP_BYTES)) {
+        wait_vblank();
+    }
+
+    return 0;
 }
@@ -0,0 +1,202 @@
+/*
+ * gba.c
+ * the hardware registers and the low level helpers which go with them
+ */
+
+#include "gba.h"
+
+#ifdef HOST
+#include "host.h"
+#endif
+
+/* the display control pointer points to the gba graphics register */
+volatile unsigned int* display_control = (volatile unsigned int*) MEM_IO(0x000);
+
+/* the control registers for the four tile layers */
+volatile unsigned short* bg0_control = (volatile unsigned short*) MEM_IO(0x008);
+volatile unsigned short* bg1_control = (volatile unsigned short*) MEM_IO(0x00a);
+volatile unsigned short* bg2_control = (volatile unsigned short*) MEM_IO(0x00c);
+volatile unsigned short* bg3_control = (volatile unsigned short*) MEM_IO(0x00e);
+
+/* scrolling registers for backgrounds */
+volatile short* bg0_x_scroll = (volatile short*) MEM_IO(0x010);
+volatile short* bg0_y_scroll = (volatile short*) MEM_IO(0x012);
+volatile short* bg1_x_scroll = (volatile short*) MEM_IO(0x014);
+volatile short* bg1_y_scroll = (volatile short*) MEM_IO(0x016);
+volatile short* bg2_x_scroll = (volatile short*) MEM_IO(0x018);
+volatile short* bg2_y_scroll = (volatile short*) MEM_IO(0x01a);
+volatile short* bg3_x_scroll = (volatile short*) MEM_IO(0x01c);
+volatile short* bg3_y_scroll = (volatile short*) MEM_IO(0x01e);
+
+/* the rotation and scaling registers of bg2 and bg3 */
+volatile struct BgAffine* bg2_affine = (volatile struct BgAffine*) MEM_IO(0x020);
+volatile struct BgAffine* bg3_affine = (volatile struct BgAffine*) MEM_IO(0x030);
+
+/* the window registers */
+volatile unsigned short* window0_horizontal = (volatile unsigned short*) MEM_IO(0x040);
+volatile unsigned short* window1_horizontal = (volatile unsigned short*) MEM_IO(0x042);
+volatile unsigned short* window0_vertical = (volatile unsigned short*) MEM_IO(0x044);
+volatile unsigned short* window1_vertical = (volatile unsigned short*) MEM_IO(0x046);
+volatile unsigned short* window_inside = (volatile unsigned short*) MEM_IO(0x048);
+volatile unsigned short* window_outside = (volatile unsigned short*) MEM_IO(0x04a);
+
+/* the blending registers */
+volatile unsigned short* blend_control = (volatile unsigned short*) MEM_IO(0x050);
+volatile unsigned short* blend_alpha = (volatile unsigned short*) MEM_IO(0x052);
+volatile unsigned short* blend_fade = (volatile unsigned short*) MEM_IO(0x054);
+
+/* the address of the color palettes used for backgrounds and sprites */
+volatile unsigned short* background_palette = (volatile unsigned short*) MEM_PALETTE(0x000);
+volatile unsigned short* sprite_palette = (volatile unsigned short*) MEM_PALETTE(0x200);
+
+/* the screen is simply a pointer into memory at a specific address, the front
+ * buffer is the start of the screen array and the back buffer is a pointer to
+ * the second half */
+volatile unsigned short* screen = (volatile unsigned short*) MEM_VRAM(0x0000);
+volatile unsigned short* front_buffer = (volatile unsigned short*) MEM_VRAM(0x0000);
+volatile unsigned short* back_buffer = (volatile unsigned short*) MEM_VRAM(0xA000);
+
+/* the memory location which controls sprite attributes */
+volatile unsigned short* sprite_attribute_memory = (volatile unsigned short*) MEM_OAM(0x000);
+
+/* the memory location which stores sprite image data */
+volatile unsigned short* sprite_image_memory = (volatile unsigned short*) MEM_VRAM(0x10000);
+
+/* pointers to the DMA 0 source, destination and count/control */
+volatile unsigned int* dma0_source = (volatile unsigned int*) MEM_IO(0x0b0);
+volatile unsigned int* dma0_destination = (volatile unsigned int*) MEM_IO(0x0b4);
+volatile unsigned int* dma0_count = (volatile unsigned int*) MEM_IO(0x0b8);
+
+/* pointers to the DMA 1 source, destination and count/control */
+volatile unsigned int* dma1_source = (volatile unsigned int*) MEM_IO(0x0bc);
+volatile unsigned int* dma1_destination = (volatile unsigned int*) MEM_IO(0x0c0);
+volatile unsigned int* dma1_count = (volatile unsigned int*) MEM_IO(0x0c4);
+
+/* pointers to the DMA 3 source, destination and count/control */
+volatile unsigned int* dma_source = (volatile unsigned int*) MEM_IO(0x0d4);
+volatile unsigned int* dma_destination = (volatile unsigned int*) MEM_IO(0x0d8);
+volatile unsigned int* dma_count = (volatile unsigned int*) MEM_IO(0x0dc);
+
+/* the data and control registers for the four timers */
+volatile unsigned short* timer0_data = (volatile unsigned short*) MEM_IO(0x100);
+volatile unsigned short* timer0_control = (volatile unsigned short*) MEM_IO(0x102);
+volatile unsigned short* timer1_data = (volatile unsigned short*) MEM_IO(0x104);
+volatile unsigned short* timer1_control = (volatile unsigned short*) MEM_IO(0x106);
+volatile unsigned short* timer2_data = (volatile unsigned short*) MEM_IO(0x108);
+volatile unsigned short* timer2_control = (volatile unsigned short*) MEM_IO(0x10a);
+volatile unsigned short* timer3_data = (volatile unsigned short*) MEM_IO(0x10c);
+volatile unsigned short* timer3_control = (volatile unsigned short*) MEM_IO(0x10e);
+
+/* the sound registers */
+volatile unsigned short* sound_square1_sweep = (volatile unsigned short*) MEM_IO(0x060);
+volatile unsigned short* sound_square1_envelope = (volatile unsigned short*) MEM_IO(0x062);
+volatile unsigned short* sound_square1_frequency = (volatile unsigned short*) MEM_IO(0x064);
+volatile unsigned short* sound_square2_envelope = (volatile unsigned short*) MEM_IO(0x068);
+volatile unsigned short* sound_square2_frequency = (volatile unsigned short*) MEM_IO(0x06c);
+volatile unsigned short* sound_noise_envelope = (volatile unsigned short*) MEM_IO(0x078);
+volatile unsigned short* sound_noise_frequency = (volatile unsigned short*) MEM_IO(0x07c);
+volatile unsigned short* sound_control = (volatile unsigned short*) MEM_IO(0x080);
+volatile unsigned short* sound_direct = (volatile unsigned short*) MEM_IO(0x082);
+volatile unsigned short* sound_master = (volatile unsigned short*) MEM_IO(0x084);
+volatile unsigned int* sound_fifo_a = (volatile unsigned int*) MEM_IO(0x0a0);
+volatile unsigned int* sound_fifo_b = (volatile unsigned int*) MEM_IO(0x0a4);
+
+/* the button register */
+volatile unsigned short* buttons = (volatile unsigned short*) MEM_IO(0x130);
+
+/* the display status register */
+volatile unsigned short* display_status = (volatile unsigned short*) MEM_IO(0x004);
+
+/* the interrupt enable, flags and master enable registers */
+volatile unsigned short* interrupt_enable = (volatile unsigned short*) MEM_IO(0x200);
+volatile unsigned short* interrupt_flags = (volatile unsigned short*) MEM_IO(0x202);
+volatile unsigned short* interrupt_master = (volatile unsigned short*) MEM_IO(0x208);
+
+/* the scanline counter */
+volatile unsigned short* scanline_counter = (volatile unsigned short*) MEM_IO(0x006);
+
+/* return a pointer to one of the 4 character blocks (0-3) */
+volatile unsigned short* char_block(unsigned long block) {
+    /* they are each 16K big */
+    return (volatile unsigned short*) MEM_VRAM(block * 0x4000);
+}
+
+/* return a pointer to one of the 32 screen blocks (0-31) */
+volatile unsigned short* screen_block(unsigned long block) {
+    /* they are each 2K big */
+    return (volatile unsigned short*) MEM_VRAM(block * 0x800);
+}
+
+/* copy data using DMA */
+void memcpy16_dma(unsigned short* dest, unsigned short* source, int amount) {
+#ifdef HOST
+    /* the host has no DMA controller, so the shim does the copy */
+    host_dma(dest, source, amount, 2);
+#else
+    *dma_source = (unsigned int) source;
+    *dma_destination = (unsigned int) dest;
+    *dma_count = amount | DMA_16 | DMA_ENABLE;
+#endif
+}
+
+/* copy data using DMA a word at a time */
+void memcpy32_dma(void* dest, const void* source, int amount) {
+#ifdef HOST
+    host_dma(dest, source, amount, 4);
+#else
+    *dma_source = (unsigned int) source;
+    *dma_destination = (unsigned int) dest;
+    *dma_count = amount | DMA_32 | DMA_ENABLE;
+#endif
+}
+
+/* copy words to the same place at the end of each line drawn */
+void dma_hblank_start(volatile void* dest, const void* source, int amount) {
+#ifdef HOST
+    /* the registers only hold 32-bit addresses, so the shim is told directly */
+    host_hblank_dma((void*) dest, source, amount);
+#else
+    *dma0_count = 0;
+    *dma0_source = (unsigned int) source;
+    *dma0_destination = (unsigned int) dest;
+    *dma0_count = amount | DMA_32 | DMA_DEST_RELOAD | DMA_REPEAT | DMA_AT_HBLANK | DMA_ENABLE;
+#endif
+}
+
+/* stop the hblank copies */
+void dma_hblank_stop() {
+#ifdef HOST
+    host_hblank_dma(0, 0, 0);
+#else
+    *dma0_count = 0;
+#endif
+}
+
+/* wait for the screen to be fully drawn so we can do something during vblank */
+void wait_vblank() {
+#ifdef HOST
+    /* nothing draws the screen on the host, so the shim steps the frame */
+    host_vblank();
+#else
+    /* wait until all 160 lines have been updated */
+    while (*scanline_counter < 160) { }
+#endif
+}
+
+/* copy bytes out of the save memory */
+void sram_read(unsigned int offset, void* dest, int size) {
+    volatile unsigned char* sram = (volatile unsigned char*) MEM_SRAM(offset);
+    unsigned char* bytes = (unsigned char*) dest;
+    for (int i = 0; i < size; i++) {
+        bytes[i] = sram[i];
+    }
+}
+
+/* copy bytes into the save memory */
+void sram_write(unsigned int offset, const void* source, int size) {
+    volatile unsigned char* sram = (volatile unsigned char*) MEM_SRAM(offset);
+    const unsigned char* bytes = (const unsigned char*) source;
+    for (int i = 0; i < size; i++) {
+        sram[i] = bytes[i];
+    }
+}
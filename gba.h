@@ -0,0 +1,356 @@
+/*
+ * gba.h
+ * hardware definitions shared by the demos and the engine modules
+ */
+
+#ifndef GBA_H
+#define GBA_H
+
+/* the width and height of the screen */
+#define SCREEN_WIDTH 240
+#define SCREEN_HEIGHT 160
+
+/* when building for the host shim the memory regions are plain arrays which
+ * host.c provides, otherwise they are the fixed hardware addresses */
+#ifdef HOST
+extern unsigned char host_io[];
+extern unsigned char host_palette[];
+extern unsigned char host_vram[];
+extern unsigned char host_oam[];
+extern unsigned char host_sram[];
+#define MEM_IO(offset) (host_io + (offset))
+#define MEM_PALETTE(offset) (host_palette + (offset))
+#define MEM_VRAM(offset) (host_vram + (offset))
+#define MEM_OAM(offset) (host_oam + (offset))
+#define MEM_SRAM(offset) (host_sram + (offset))
+#else
+#define MEM_IO(offset) (0x4000000 + (offset))
+#define MEM_PALETTE(offset) (0x5000000 + (offset))
+#define MEM_VRAM(offset) (0x6000000 + (offset))
+#define MEM_OAM(offset) (0x7000000 + (offset))
+#define MEM_SRAM(offset) (0xE000000 + (offset))
+#endif
+
+/* code which runs a lot can be put in the 32K of IWRAM and compiled as ARM
+ * rather than Thumb, so it is fetched over a 32-bit bus with no wait states
+ * instead of the 16-bit ROM bus, this only happens when building with
+ * USE_IWRAM, on the host shim the functions are put in their own section so
+ * its cycle model can tell when they are running, IWRAM_ARM_CODE is for the
+ * few functions which have to be ARM code in IWRAM whatever the build, like
+ * the interrupt handler the BIOS jumps to in ARM state */
+#ifdef HOST
+#define IWRAM_ARM_CODE __attribute__((section("iwram")))
+#else
+#define IWRAM_ARM_CODE __attribute__((section(".iwram"), long_call, target("arm"), noinline))
+#endif
+#ifdef USE_IWRAM
+#define IWRAM_CODE IWRAM_ARM_CODE
+#else
+#define IWRAM_CODE
+#endif
+
+/* big buffers which are not touched often can go in the 256K of EWRAM
+ * rather than the 32K of IWRAM, where the rest of the variables are */
+#ifdef HOST
+#define EWRAM_BSS
+#else
+#define EWRAM_BSS __attribute__((section(".sbss")))
+#endif
+
+/* the display control pointer points to the gba graphics register */
+extern volatile unsigned int* display_control;
+
+/* the video modes */
+#define MODE0 0x00
+#define MODE1 0x01
+#define MODE2 0x02
+#define MODE3 0x03
+#define MODE4 0x04
+#define MODE5 0x05
+
+/* this bit indicates whether to display the front or the back buffer */
+#define SHOW_BACK 0x10
+
+/* this bit lets OAM be written during hblank, at the cost of fewer sprite
+ * pixels per line */
+#define HBLANK_OAM 0x20
+
+/* flags to set sprite handling in display control register */
+#define SPRITE_MAP_2D 0x0
+#define SPRITE_MAP_1D 0x40
+
+/* enable bits for the four tile layers and the sprites */
+#define BG0_ENABLE 0x100
+#define BG1_ENABLE 0x200
+#define BG2_ENABLE 0x400
+#define BG3_ENABLE 0x800
+#define SPRITE_ENABLE 0x1000
+
+/* enable bits for the two rectangular windows and the sprite window */
+#define WIN0_ENABLE 0x2000
+#define WIN1_ENABLE 0x4000
+#define SPRITE_WIN_ENABLE 0x8000
+
+/* the control registers for the four tile layers */
+extern volatile unsigned short* bg0_control;
+extern volatile unsigned short* bg1_control;
+extern volatile unsigned short* bg2_control;
+extern volatile unsigned short* bg3_control;
+
+/* scrolling registers for backgrounds */
+extern volatile short* bg0_x_scroll;
+extern volatile short* bg0_y_scroll;
+extern volatile short* bg1_x_scroll;
+extern volatile short* bg1_y_scroll;
+extern volatile short* bg2_x_scroll;
+extern volatile short* bg2_y_scroll;
+extern volatile short* bg3_x_scroll;
+extern volatile short* bg3_y_scroll;
+
+/* the rotation and scaling registers of bg2 and bg3 in modes 1 and 2, the
+ * matrix is 8.8 fixed point and maps screen pixels to texture pixels, x
+ * and y are the texture position of the top left of the screen in 20.8 */
+struct BgAffine {
+    short pa, pb;
+    short pc, pd;
+    int x, y;
+};
+extern volatile struct BgAffine* bg2_affine;
+extern volatile struct BgAffine* bg3_affine;
+
+/* the window registers, the horizontal and vertical ones hold the left or
+ * top edge in their high byte and the right or bottom edge (one past the
+ * last pixel) in their low byte, the inside and outside ones say which
+ * layers show in each part of the screen */
+extern volatile unsigned short* window0_horizontal;
+extern volatile unsigned short* window1_horizontal;
+extern volatile unsigned short* window0_vertical;
+extern volatile unsigned short* window1_vertical;
+extern volatile unsigned short* window_inside;
+extern volatile unsigned short* window_outside;
+
+/* the blending registers, which layers blend onto which and how, the two
+ * alpha weights and the fade level, all out of 16 */
+extern volatile unsigned short* blend_control;
+extern volatile unsigned short* blend_alpha;
+extern volatile unsigned short* blend_fade;
+
+/* palette is always 256 colors */
+#define PALETTE_SIZE 256
+
+/* the address of the color palettes used for backgrounds and sprites */
+extern volatile unsigned short* background_palette;
+extern volatile unsigned short* sprite_palette;
+
+/* the screen and the two mode 4 pages */
+extern volatile unsigned short* screen;
+extern volatile unsigned short* front_buffer;
+extern volatile unsigned short* back_buffer;
+
+/* the memory location which controls sprite attributes */
+extern volatile unsigned short* sprite_attribute_memory;
+
+/* the memory location which stores sprite image data */
+extern volatile unsigned short* sprite_image_memory;
+
+/* return a pointer to one of the 4 character blocks (0-3) */
+volatile unsigned short* char_block(unsigned long block);
+
+/* return a pointer to one of the 32 screen blocks (0-31) */
+volatile unsigned short* screen_block(unsigned long block);
+
+/* flag for turning on DMA */
+#define DMA_ENABLE 0x80000000
+
+/* flags for the sizes to transfer, 16 or 32 bits */
+#define DMA_16 0x00000000
+#define DMA_32 0x04000000
+
+/* pointers to the DMA 3 source, destination and count/control */
+extern volatile unsigned int* dma_source;
+extern volatile unsigned int* dma_destination;
+extern volatile unsigned int* dma_count;
+
+/* copy data using DMA, the amount is in halfwords */
+void memcpy16_dma(unsigned short* dest, unsigned short* source, int amount);
+
+/* flags for DMA 0, which can be started on every hblank and left
+ * repeating, reloading its destination each time */
+#define DMA_DEST_RELOAD 0x00600000
+#define DMA_REPEAT 0x02000000
+#define DMA_AT_HBLANK 0x20000000
+
+/* pointers to the DMA 0 source, destination and count/control */
+extern volatile unsigned int* dma0_source;
+extern volatile unsigned int* dma0_destination;
+extern volatile unsigned int* dma0_count;
+
+/* DMA 1 and 2 can feed the sound FIFOs, they send 4 words whenever the
+ * FIFO asks for more, to the same address each time */
+#define DMA_DEST_FIXED 0x00400000
+#define DMA_AT_FIFO 0x30000000
+
+/* pointers to the DMA 1 source, destination and count/control */
+extern volatile unsigned int* dma1_source;
+extern volatile unsigned int* dma1_destination;
+extern volatile unsigned int* dma1_count;
+
+/* copy a number of words from source to dest at the end of each line drawn,
+ * moving on through the source each time, this is started in vblank and
+ * has to be restarted every frame */
+void dma_hblank_start(volatile void* dest, const void* source, int amount);
+void dma_hblank_stop();
+
+/* copy data using DMA a word at a time, which takes half as many transfers,
+ * both pointers must be word aligned and the amount is in words */
+void memcpy32_dma(void* dest, const void* source, int amount);
+
+/* the data and control registers for the four timers, timers 0 and 1 can
+ * drive the sound FIFOs */
+extern volatile unsigned short* timer0_data;
+extern volatile unsigned short* timer0_control;
+extern volatile unsigned short* timer1_data;
+extern volatile unsigned short* timer1_control;
+extern volatile unsigned short* timer2_data;
+extern volatile unsigned short* timer2_control;
+extern volatile unsigned short* timer3_data;
+extern volatile unsigned short* timer3_control;
+
+/* timer control flags, the frequency is the number of cycles per tick */
+#define TIMER_FREQ_1 0x0
+#define TIMER_FREQ_64 0x1
+#define TIMER_FREQ_256 0x2
+#define TIMER_FREQ_1024 0x3
+#define TIMER_CASCADE 0x4
+#define TIMER_IRQ 0x40
+#define TIMER_ENABLE 0x80
+
+/* the CPU runs at 2^24 cycles per second, and each scanline takes 1232 of
+ * them, 160 visible lines and 68 lines of vblank make up a frame */
+#define CYCLES_PER_SCANLINE 1232
+#define SCANLINES_PER_FRAME 228
+#define CYCLES_PER_FRAME (CYCLES_PER_SCANLINE * SCANLINES_PER_FRAME)
+
+/* the sound registers, the PSG channel mix, the Direct Sound mix and
+ * master enable, and the two Direct Sound FIFOs which take 4 signed 8-bit
+ * samples a write */
+extern volatile unsigned short* sound_control;
+extern volatile unsigned short* sound_direct;
+extern volatile unsigned short* sound_master;
+extern volatile unsigned int* sound_fifo_a;
+extern volatile unsigned int* sound_fifo_b;
+
+/* the PSG channel registers, square 1 has a sweep register before the two
+ * it shares with square 2, the first holds the duty cycle and envelope and
+ * the second the frequency, and noise has the same envelope register and
+ * one for its clock */
+extern volatile unsigned short* sound_square1_sweep;
+extern volatile unsigned short* sound_square1_envelope;
+extern volatile unsigned short* sound_square1_frequency;
+extern volatile unsigned short* sound_square2_envelope;
+extern volatile unsigned short* sound_square2_frequency;
+extern volatile unsigned short* sound_noise_envelope;
+extern volatile unsigned short* sound_noise_frequency;
+
+/* writing this bit to a frequency register starts the note again */
+#define SOUND_RESTART 0x8000
+
+/* the PSG mix flags, the volume of each side and which channels go where */
+#define SOUND_PSG_VOLUME(left, right) ((right) | ((left) << 4))
+#define SOUND_PSG_RIGHT(channels) ((channels) << 8)
+#define SOUND_PSG_LEFT(channels) ((channels) << 12)
+#define SOUND_SQUARE1 0x1
+#define SOUND_SQUARE2 0x2
+#define SOUND_WAVE 0x4
+#define SOUND_NOISE 0x8
+
+/* Direct Sound mix flags, the first two bits are the PSG volume */
+#define SOUND_PSG_FULL 0x0002
+#define SOUND_A_FULL 0x0004
+#define SOUND_B_FULL 0x0008
+#define SOUND_A_RIGHT 0x0100
+#define SOUND_A_LEFT 0x0200
+#define SOUND_A_TIMER1 0x0400
+#define SOUND_A_RESET 0x0800
+#define SOUND_B_RIGHT 0x1000
+#define SOUND_B_LEFT 0x2000
+#define SOUND_B_TIMER1 0x4000
+#define SOUND_B_RESET 0x8000
+
+/* the master sound enable */
+#define SOUND_ENABLE 0x0080
+
+/* the button register holds the bits which indicate whether each button has
+ * been pressed - this has got to be volatile as well */
+extern volatile unsigned short* buttons;
+
+/* the bit positions indicate each button - the first bit is for A, second for
+ * B, and so on, each constant below can be ANDED into the register to get the
+ * status of any one button */
+#define BUTTON_A (1 << 0)
+#define BUTTON_B (1 << 1)
+#define BUTTON_SELECT (1 << 2)
+#define BUTTON_START (1 << 3)
+#define BUTTON_RIGHT (1 << 4)
+#define BUTTON_LEFT (1 << 5)
+#define BUTTON_UP (1 << 6)
+#define BUTTON_DOWN (1 << 7)
+#define BUTTON_R (1 << 8)
+#define BUTTON_L (1 << 9)
+
+/* all ten buttons together */
+#define BUTTON_MASK 0x03ff
+
+/* the display status register, which turns on the display interrupts and
+ * holds the scanline the vcount interrupt goes off on in its high byte */
+extern volatile unsigned short* display_status;
+#define STATUS_VBLANK_IRQ 0x08
+#define STATUS_HBLANK_IRQ 0x10
+#define STATUS_VCOUNT_IRQ 0x20
+
+/* the interrupt enable, flags and master enable registers */
+extern volatile unsigned short* interrupt_enable;
+extern volatile unsigned short* interrupt_flags;
+extern volatile unsigned short* interrupt_master;
+
+/* the interrupts, each is a bit in the enable and flags registers */
+#define INT_VBLANK 0
+#define INT_HBLANK 1
+#define INT_VCOUNT 2
+#define INT_TIMER0 3
+#define INT_TIMER1 4
+#define INT_TIMER2 5
+#define INT_TIMER3 6
+#define INT_SERIAL 7
+#define INT_DMA0 8
+#define INT_DMA1 9
+#define INT_DMA2 10
+#define INT_DMA3 11
+#define INT_KEYPAD 12
+#define INT_CART 13
+#define INT_COUNT 14
+
+/* the scanline counter is a memory cell which is updated to indicate how
+ * much of the screen has been drawn */
+extern volatile unsigned short* scanline_counter;
+
+/* wait for the screen to be fully drawn so we can do something during vblank */
+void wait_vblank();
+
+/* the battery backed save memory is 32K and only has an 8-bit bus, so it is
+ * always accessed a byte at a time */
+#define SRAM_SIZE 0x8000
+
+/* how the save memory is divided up */
+#define SRAM_REPLAY_OFFSET 0x0000
+#define SRAM_REPLAY_SIZE 0x6000
+#define SRAM_PROFILE_OFFSET 0x6000
+#define SRAM_PROFILE_SIZE 0x1000
+#define SRAM_SAVE_OFFSET 0x7000
+#define SRAM_SAVE_SIZE 0x1000
+
+/* copy bytes to and from the save memory */
+void sram_read(unsigned int offset, void* dest, int size);
+void sram_write(unsigned int offset, const void* source, int size);
+
+#endif
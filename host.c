@@ -0,0 +1,298 @@
+/*
+ * host.c
+ * the host shim which backs the hardware memory regions with arrays
+ *
+ * the save memory is loaded from the file named by GBA_SRAM when the program
+ * starts and written back to it when it exits, which is the same format
+ * emulators use for .sav files
+ *
+ * the sound the mixer would have played is written to the WAV file named by
+ * GBA_WAV, if it is set
+ *
+ * the shim also keeps the cycle count which stands in for the profiler's
+ * timers, from a model of what the instrumented code would cost on the GBA
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gba.h"
+#include "host.h"
+
+/* the hardware memory regions */
+unsigned char host_io[0x400] __attribute__((aligned(4)));
+unsigned char host_palette[0x400] __attribute__((aligned(4)));
+unsigned char host_vram[0x18000] __attribute__((aligned(4)));
+unsigned char host_oam[0x400] __attribute__((aligned(4)));
+unsigned char host_sram[SRAM_SIZE] __attribute__((aligned(4)));
+
+/* the number of frames the shim has stepped through */
+unsigned long host_frame = 0;
+
+/* the interrupt handler which interrupt_init installed */
+void (*host_interrupt)() = NULL;
+
+/* the repeating hblank DMA transfer, if there is one */
+static void* host_hblank_dest = NULL;
+static const unsigned char* host_hblank_source = NULL;
+static int host_hblank_words = 0;
+
+/* the cycle count when the last vblank started, the display runs on at a
+ * frame every CYCLES_PER_FRAME cycles whatever the program is doing */
+static unsigned long long host_vblank_cycles = 0;
+
+/* the cycle count under the cost model, the engine and the demos are built
+ * with hooks on every basic block and every memory access, and the shim
+ * adds up what each would cost on the GBA, so the same run always gives the
+ * same count whatever the host is doing */
+static unsigned long long host_cycle_count = 0;
+
+/* code runs as Thumb from ROM, which with the default 4/2 wait states takes
+ * 3 cycles to fetch each 16-bit instruction, or as ARM from IWRAM, which
+ * fetches each 32-bit instruction in 1 cycle, a basic block is taken to be
+ * about four instructions plus the two fetches to refill the pipeline after
+ * the branch into it either way, so only the fetches are modelled and not
+ * ARM needing fewer instructions for the same work */
+#define HOST_ROM_FETCH_CYCLES 3
+#define HOST_IWRAM_FETCH_CYCLES 1
+#define HOST_BLOCK_FETCHES 6
+
+/* the bounds of the IWRAM_CODE functions, which the linker provides when
+ * there are any */
+extern char __start_iwram[] __attribute__((weak));
+extern char __stop_iwram[] __attribute__((weak));
+
+/* the GBA's memory regions as the host has them, the width of the bus to
+ * each and the cycles an access over it takes, IWRAM is the default since
+ * the stack and most variables are there */
+struct HostRegion {
+    const unsigned char* start;
+    const unsigned char* end;
+    int bus;
+    int cycles;
+};
+
+/* the read only data the linker puts between the code and the variables,
+ * which is in ROM on the GBA */
+extern unsigned char etext[], __data_start[];
+
+static const struct HostRegion host_regions[] = {
+    {host_io, host_io + sizeof(host_io), 4, 1},
+    {host_palette, host_palette + sizeof(host_palette), 2, 1},
+    {host_vram, host_vram + sizeof(host_vram), 2, 1},
+    {host_oam, host_oam + sizeof(host_oam), 4, 1},
+    {host_sram, host_sram + SRAM_SIZE, 1, 5},
+    {etext, __data_start, 2, 3}
+};
+#define HOST_REGIONS (sizeof(host_regions) / sizeof(host_regions[0]))
+
+/* the WAV file being written, and the number of samples in it */
+static FILE* host_wav = NULL;
+static unsigned int host_wav_samples = 0;
+static int host_wav_rate = 0;
+
+/* write a WAV header for mono 8-bit samples */
+static void host_wav_header(unsigned int samples, int rate) {
+    unsigned int header[11] = {
+        0x46464952, 36 + samples,           /* "RIFF" and the size after this */
+        0x45564157, 0x20746d66, 16,         /* "WAVE", "fmt " and its size */
+        1 | (1 << 16), rate, rate,          /* PCM, one channel, the byte rate */
+        1 | (8 << 16),                      /* a byte a sample, 8 bits */
+        0x61746164, samples                 /* "data" and its size */
+    };
+    fseek(host_wav, 0, SEEK_SET);
+    fwrite(header, sizeof(header), 1, host_wav);
+    fseek(host_wav, 0, SEEK_END);
+}
+
+/* fill in the sizes in the WAV header once all the samples are there */
+static void host_close_wav() {
+    host_wav_header(host_wav_samples, host_wav_rate);
+    fclose(host_wav);
+}
+
+/* write the save memory back to its file */
+static void host_save_sram() {
+    const char* path = getenv("GBA_SRAM");
+    if (path == NULL) {
+        return;
+    }
+
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return;
+    }
+    fwrite(host_sram, 1, SRAM_SIZE, f);
+    fclose(f);
+}
+
+/* set up the hardware state before main runs */
+__attribute__((constructor)) static void host_init() {
+    /* the button register is active low, so no buttons are down */
+    *buttons = BUTTON_MASK;
+
+    /* unwritten save memory reads back as all ones */
+    memset(host_sram, 0xff, SRAM_SIZE);
+
+    /* load the save memory if there is one */
+    const char* path = getenv("GBA_SRAM");
+    if (path != NULL) {
+        FILE* f = fopen(path, "rb");
+        if (f != NULL) {
+            if (fread(host_sram, 1, SRAM_SIZE, f) == 0) {
+                fprintf(stderr, "%s: empty save file\n", path);
+            }
+            fclose(f);
+        }
+        atexit(host_save_sram);
+    }
+}
+
+/* raise an interrupt if it is turned on */
+static void host_raise(int interrupt) {
+    if (host_interrupt != NULL && *interrupt_master && (*interrupt_enable & (1 << interrupt))) {
+        *interrupt_flags = 1 << interrupt;
+        host_interrupt();
+        *interrupt_flags = 0;
+    }
+}
+
+/* step through the lines of the frame being drawn to the next vblank */
+void host_vblank() {
+    for (int line = 0; line < SCREEN_HEIGHT; line++) {
+        *scanline_counter = line;
+        if ((*display_status & STATUS_VCOUNT_IRQ) && (*display_status >> 8) == line) {
+            host_raise(INT_VCOUNT);
+        }
+        if (*display_status & STATUS_HBLANK_IRQ) {
+            host_raise(INT_HBLANK);
+        }
+        if (host_hblank_words > 0) {
+            memmove(host_hblank_dest, host_hblank_source, host_hblank_words * 4);
+            host_hblank_source += host_hblank_words * 4;
+        }
+    }
+
+    /* waiting takes the program to the start of the next vblank, which is
+     * a frame after the last one, or more if it took longer than that */
+    host_frame++;
+    host_vblank_cycles += CYCLES_PER_FRAME;
+    while (host_vblank_cycles < host_cycle_count) {
+        host_vblank_cycles += CYCLES_PER_FRAME;
+    }
+    host_cycle_count = host_vblank_cycles;
+    *scanline_counter = SCREEN_HEIGHT;
+    if (*display_status & STATUS_VBLANK_IRQ) {
+        host_raise(INT_VBLANK);
+    }
+}
+
+/* the cycles an access of a number of bytes takes, by the memory it is in */
+static unsigned int host_access_cycles(const void* address, unsigned int bytes) {
+    const unsigned char* p = (const unsigned char*) address;
+    int bus = 4, cycles = 1;
+
+    for (unsigned int i = 0; i < HOST_REGIONS; i++) {
+        if (p >= host_regions[i].start && p < host_regions[i].end) {
+            bus = host_regions[i].bus;
+            cycles = host_regions[i].cycles;
+            break;
+        }
+    }
+    return (bytes + bus - 1) / bus * cycles;
+}
+
+/* the cycles used since the program started, under the cost model */
+unsigned int host_cycles() {
+    return (unsigned int) host_cycle_count;
+}
+
+/* called at the start of every basic block in the instrumented code, which
+ * is fetched from IWRAM if the block is in an IWRAM_CODE function */
+void __sanitizer_cov_trace_pc() {
+    char* block = (char*) __builtin_return_address(0);
+    if (block >= __start_iwram && block < __stop_iwram) {
+        host_cycle_count += HOST_BLOCK_FETCHES * HOST_IWRAM_FETCH_CYCLES;
+    } else {
+        host_cycle_count += HOST_BLOCK_FETCHES * HOST_ROM_FETCH_CYCLES;
+    }
+}
+
+/* called for every load and store in the instrumented code */
+#define HOST_ACCESS(bytes) \
+    void __asan_load##bytes##_noabort(void* address) { \
+        host_cycle_count += host_access_cycles(address, bytes); \
+    } \
+    void __asan_store##bytes##_noabort(void* address) { \
+        host_cycle_count += host_access_cycles(address, bytes); \
+    }
+HOST_ACCESS(1)
+HOST_ACCESS(2)
+HOST_ACCESS(4)
+HOST_ACCESS(8)
+HOST_ACCESS(16)
+
+void __asan_loadN_noabort(void* address, unsigned long bytes) {
+    host_cycle_count += host_access_cycles(address, bytes);
+}
+
+void __asan_storeN_noabort(void* address, unsigned long bytes) {
+    host_cycle_count += host_access_cycles(address, bytes);
+}
+
+/* called before functions which do not return, there is nothing to do */
+void __asan_handle_no_return() {
+}
+
+/* the scanline the display would be on, from the cycles the model has
+ * counted since the last vblank started */
+unsigned short host_scanline() {
+    unsigned int lines = (host_cycle_count - host_vblank_cycles) / CYCLES_PER_SCANLINE;
+    return (SCREEN_HEIGHT + lines) % SCANLINES_PER_FRAME;
+}
+
+/* do a DMA transfer of a number of units of 2 or 4 bytes, each unit costs
+ * a read and a write, with a couple of cycles to start the transfer */
+void host_dma(void* dest, const void* source, int count, int size) {
+    host_cycle_count += 2 + count * (host_access_cycles(source, size) +
+            host_access_cycles(dest, size));
+    memmove(dest, source, count * size);
+}
+
+/* keep a frame of sound */
+void host_audio(const signed char* samples, int count, int rate) {
+    static int opened = 0;
+    if (!opened) {
+        opened = 1;
+        const char* path = getenv("GBA_WAV");
+        if (path == NULL) {
+            return;
+        }
+        host_wav = fopen(path, "wb");
+        if (host_wav == NULL) {
+            perror(path);
+            return;
+        }
+        host_wav_rate = rate;
+        host_wav_header(0, rate);
+        atexit(host_close_wav);
+    }
+    if (host_wav == NULL) {
+        return;
+    }
+
+    /* WAV files keep 8-bit samples unsigned */
+    for (int i = 0; i < count; i++) {
+        fputc((unsigned char) (samples[i] + 128), host_wav);
+    }
+    host_wav_samples += count;
+}
+
+/* start or stop the repeating hblank transfer */
+void host_hblank_dma(void* dest, const void* source, int words) {
+    host_hblank_dest = dest;
+    host_hblank_source = (const unsigned char*) source;
+    host_hblank_words = words;
+}
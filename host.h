@@ -0,0 +1,40 @@
+/*
+ * host.h
+ * the host shim which lets the demos run as ordinary programs on a PC, the
+ * hardware memory regions become arrays and the shim stands in for the parts
+ * of the hardware which do work on their own (the display and DMA)
+ */
+
+#ifndef HOST_H
+#define HOST_H
+
+/* the number of frames the shim has stepped through */
+extern unsigned long host_frame;
+
+/* the interrupt handler which interrupt_init installed */
+extern void (*host_interrupt)();
+
+/* step through the lines of the frame being drawn, raising any display
+ * interrupts which are turned on, to the start of the next vertical blank */
+void host_vblank();
+
+/* the host stands in for timers 2 and 3 with the cycles used since it
+ * started, which are not timed but added up by the cost model in host.c from
+ * the basic blocks run, the memory they touch and the DMA transfers */
+unsigned int host_cycles();
+
+/* the scanline the display would be on, counting from the last vblank */
+unsigned short host_scanline();
+
+/* do a DMA transfer of a number of units, size is 2 or 4 bytes */
+void host_dma(void* dest, const void* source, int count, int size);
+
+/* copy a number of words to dest at the end of each line host_vblank steps
+ * through, moving on through the source each time, 0 words stops it */
+void host_hblank_dma(void* dest, const void* source, int words);
+
+/* keep a frame of sound, signed 8-bit samples at rate samples a second,
+ * which are written to the WAV file named by GBA_WAV if it is set */
+void host_audio(const signed char* samples, int count, int rate);
+
+#endif
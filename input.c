@@ -0,0 +1,199 @@
+/*
+ * input.c
+ * per frame button state with run-length encoded recording and replay
+ *
+ * a replay is stored in SRAM as a 16 byte header followed by runs, each run
+ * is a 16-bit button mask (1 means down) and a 16-bit count of the frames it
+ * lasted, all little endian
+ */
+
+#include "gba.h"
+#include "input.h"
+
+/* the replay header fields */
+#define REPLAY_MAGIC 0x59504c52   /* "RPLY" */
+#define REPLAY_VERSION 1
+#define REPLAY_HEADER_SIZE 16
+#define REPLAY_RUN_SIZE 4
+#define REPLAY_MAX_RUNS ((SRAM_REPLAY_SIZE - REPLAY_HEADER_SIZE) / REPLAY_RUN_SIZE)
+
+/* the replay header as it sits in SRAM */
+struct ReplayHeader {
+    unsigned int magic;
+    unsigned short version;
+    unsigned short reserved;
+    unsigned int runs;
+    unsigned int frames;
+};
+
+/* the current mode and the number of frames polled so far */
+enum InputMode input_mode = INPUT_LIVE;
+unsigned long input_frame = 0;
+
+/* the buttons which are down this frame */
+static unsigned short input_keys = 0;
+
+/* the run being recorded or played back */
+static unsigned short run_keys = 0;
+static unsigned int run_length = 0;
+
+/* the number of runs recorded or played back so far */
+static unsigned int run_index = 0;
+static unsigned int run_total = 0;
+
+/* read the buttons straight from the keypad, with 1 meaning down */
+static unsigned short input_read_keypad() {
+    return ~*buttons & BUTTON_MASK;
+}
+
+/* write the header for everything recorded so far */
+static void input_write_header() {
+    struct ReplayHeader header;
+    header.magic = REPLAY_MAGIC;
+    header.version = REPLAY_VERSION;
+    header.reserved = 0;
+    header.runs = run_index;
+    header.frames = input_frame;
+    sram_write(SRAM_REPLAY_OFFSET, &header, REPLAY_HEADER_SIZE);
+}
+
+/* store the current run and start a new one */
+static void input_flush_run() {
+    unsigned short run[2];
+
+    /* once SRAM is full the rest of the session is not recorded */
+    if (run_index >= REPLAY_MAX_RUNS) {
+        input_mode = INPUT_LIVE;
+        return;
+    }
+
+    run[0] = run_keys;
+    run[1] = run_length;
+    sram_write(SRAM_REPLAY_OFFSET + REPLAY_HEADER_SIZE + run_index * REPLAY_RUN_SIZE,
+            run, REPLAY_RUN_SIZE);
+    run_index++;
+
+    /* keep the header up to date since a recording has no clean end */
+    input_write_header();
+}
+
+/* start recording into SRAM */
+void input_record_start() {
+    input_mode = INPUT_RECORD;
+    input_frame = 0;
+    run_index = 0;
+    run_length = 0;
+    input_write_header();
+}
+
+/* store the run in progress and stop recording */
+void input_record_stop() {
+    if (input_mode == INPUT_RECORD && run_length > 0) {
+        input_flush_run();
+    }
+    input_mode = INPUT_LIVE;
+}
+
+/* start playing back the replay in SRAM, returns 0 if there is none */
+int input_replay_start() {
+    struct ReplayHeader header;
+    sram_read(SRAM_REPLAY_OFFSET, &header, REPLAY_HEADER_SIZE);
+    if (header.magic != REPLAY_MAGIC || header.version != REPLAY_VERSION ||
+            header.runs > REPLAY_MAX_RUNS) {
+        return 0;
+    }
+
+    input_mode = INPUT_REPLAY;
+    input_frame = 0;
+    run_index = 0;
+    run_total = header.runs;
+    run_length = 0;
+    return 1;
+}
+
+/* choose the input mode */
+void input_init() {
+#ifdef HOST
+    /* the host has no keypad, so it always plays back */
+    input_replay_start();
+#else
+    unsigned short keys = input_read_keypad();
+    if (keys & BUTTON_SELECT) {
+        input_record_start();
+    } else if (keys & BUTTON_START) {
+        input_replay_start();
+    }
+#endif
+}
+
+/* load the next run of a replay, returns 0 at the end */
+static int input_next_run() {
+    unsigned short run[2];
+
+    if (run_index >= run_total) {
+        return 0;
+    }
+    sram_read(SRAM_REPLAY_OFFSET + REPLAY_HEADER_SIZE + run_index * REPLAY_RUN_SIZE,
+            run, REPLAY_RUN_SIZE);
+    run_keys = run[0];
+    run_length = run[1];
+    run_index++;
+    return 1;
+}
+
+/* read the buttons for this frame */
+int input_poll() {
+    unsigned short keys;
+
+    if (input_mode == INPUT_REPLAY) {
+        /* skip to the next run once this one is used up */
+        while (run_length == 0) {
+            if (!input_next_run()) {
+                input_mode = INPUT_LIVE;
+                break;
+            }
+        }
+    }
+
+#ifdef HOST
+    /* without a replay there is nothing to drive the host */
+    if (input_mode == INPUT_LIVE) {
+        return 0;
+    }
+#endif
+
+    if (input_mode == INPUT_REPLAY) {
+        keys = run_keys;
+        run_length--;
+    } else {
+        keys = input_read_keypad();
+    }
+
+    if (input_mode == INPUT_RECORD) {
+        /* extend the current run, or store it when the buttons change */
+        if (run_length > 0 && (keys != run_keys || run_length == 0xffff)) {
+            input_flush_run();
+            run_length = 0;
+        }
+        run_keys = keys;
+        run_length++;
+    }
+
+    input_keys = keys;
+    input_frame++;
+    return 1;
+}
+
+/* the buttons which are down this frame */
+unsigned short input_buttons() {
+    return input_keys;
+}
+
+/* this function checks whether a particular button is down this frame */
+unsigned char button_pressed(unsigned short button) {
+    if (input_keys & button) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
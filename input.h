@@ -0,0 +1,40 @@
+/*
+ * input.h
+ * the button state for each frame, which can come from the keypad or from a
+ * replay which was recorded earlier
+ */
+
+#ifndef INPUT_H
+#define INPUT_H
+
+/* where the button state is coming from */
+enum InputMode {
+    INPUT_LIVE,
+    INPUT_RECORD,
+    INPUT_REPLAY
+};
+
+/* the current mode and the number of frames polled so far */
+extern enum InputMode input_mode;
+extern unsigned long input_frame;
+
+/* choose the input mode, holding select at start up records a session into
+ * SRAM and holding start plays the one which is there back */
+void input_init();
+
+/* start recording or replaying directly */
+void input_record_start();
+void input_record_stop();
+int input_replay_start();
+
+/* read the buttons for this frame, on the host shim this returns 0 once there
+ * is no replay left to play, since there is no keypad to fall back on */
+int input_poll();
+
+/* the buttons which are down this frame, with 1 meaning down */
+unsigned short input_buttons();
+
+/* this function checks whether a particular button is down this frame */
+unsigned char button_pressed(unsigned short button);
+
+#endif
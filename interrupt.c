@@ -0,0 +1,83 @@
+/*
+ * interrupt.c
+ * the interrupt handler
+ *
+ * the BIOS calls the function whose address is at the end of IWRAM with
+ * interrupts disabled, it has already saved the registers a C function is
+ * allowed to change, so the handler can be ordinary C, but the BIOS jumps
+ * to it in ARM state, so it is always built as ARM code in IWRAM even when
+ * the rest of the build is Thumb in ROM
+ */
+
+#include "gba.h"
+#include "interrupt.h"
+
+#ifdef HOST
+#include "host.h"
+#endif
+
+/* the address the BIOS jumps to, and its copy of the flags which the
+ * interrupt wait functions check */
+#ifndef HOST
+static volatile unsigned int* interrupt_vector = (volatile unsigned int*) 0x3007ffc;
+static volatile unsigned short* bios_interrupt_flags = (volatile unsigned short*) 0x3007ff8;
+#endif
+
+/* the function for each interrupt */
+static void (*interrupt_handlers[INT_COUNT])();
+
+/* the handler which the BIOS calls */
+IWRAM_ARM_CODE void interrupt_dispatch() {
+    unsigned short flags = *interrupt_flags & *interrupt_enable;
+
+    for (int i = 0; i < INT_COUNT; i++) {
+        if ((flags & (1 << i)) && interrupt_handlers[i]) {
+            interrupt_handlers[i]();
+        }
+    }
+
+    /* writing a 1 to a flag acknowledges it */
+    *interrupt_flags = flags;
+#ifndef HOST
+    *bios_interrupt_flags |= flags;
+#endif
+}
+
+/* install the handler and turn interrupts on */
+void interrupt_init() {
+    *interrupt_master = 0;
+#ifdef HOST
+    host_interrupt = interrupt_dispatch;
+#else
+    *interrupt_vector = (unsigned int) interrupt_dispatch;
+#endif
+    *interrupt_master = 1;
+}
+
+/* set the function to call for an interrupt and enable it */
+void interrupt_set(int interrupt, void (*handler)()) {
+    /* the display interrupts also have to be turned on in the display
+     * status register */
+    unsigned short status = 0;
+    switch (interrupt) {
+        case INT_VBLANK: status = STATUS_VBLANK_IRQ; break;
+        case INT_HBLANK: status = STATUS_HBLANK_IRQ; break;
+        case INT_VCOUNT: status = STATUS_VCOUNT_IRQ; break;
+    }
+
+    *interrupt_master = 0;
+    interrupt_handlers[interrupt] = handler;
+    if (handler) {
+        *interrupt_enable |= 1 << interrupt;
+        *display_status |= status;
+    } else {
+        *interrupt_enable &= ~(1 << interrupt);
+        *display_status &= ~status;
+    }
+    *interrupt_master = 1;
+}
+
+/* set the scanline the vcount interrupt goes off on */
+void interrupt_set_vcount(int line) {
+    *display_status = (*display_status & 0x00ff) | (line << 8);
+}
@@ -0,0 +1,25 @@
+/*
+ * interrupt.h
+ * one interrupt handler which hands each interrupt off to the function set
+ * up for it
+ */
+
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+#include "gba.h"
+
+/* install the handler and turn interrupts on */
+void interrupt_init();
+
+/* set the function to call for an interrupt (one of the INT_ constants) and
+ * enable it, or disable it by passing 0 */
+void interrupt_set(int interrupt, void (*handler)());
+
+/* set the scanline the vcount interrupt goes off on */
+void interrupt_set_vcount(int line);
+
+/* the handler which the BIOS calls */
+IWRAM_ARM_CODE void interrupt_dispatch();
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * layer.c
+ * loading the tile layers
+ */
+
+#include "gba.h"
+#include "layer.h"
+
+/* the tileset in each char block and the palette in each palette bank, so
+ * the same one is not uploaded twice */
+static const struct Tileset* layer_char_blocks[4];
+static const unsigned short* layer_palettes[16];
+
+/* the number of 32 byte tiles at the start of each char block which are
+ * taken, by tilesets or by layer_alloc_tiles */
+#define LAYER_BLOCK_TILES 512
+static unsigned short layer_tiles_used[4];
+
+/* the screen blocks which hold a map, one bit each, a screen block is 64
+ * tiles' worth of a char block, block n being in char block n / 8 */
+#define LAYER_SCREEN_TILES 64
+static unsigned int layer_screen_blocks = 0;
+
+/* the width and height in tiles of each layer size */
+const unsigned char layer_widths[4] = {32, 64, 32, 64};
+const unsigned char layer_heights[4] = {32, 32, 64, 64};
+
+/* copy into VRAM a word at a time when both ends are word aligned, which
+ * the tools normally make them, or a halfword at a time if not */
+void layer_copy(volatile unsigned short* dest, const void* source, unsigned int bytes) {
+    if ((((unsigned long) dest | (unsigned long) source | bytes) & 3) == 0) {
+        memcpy32_dma((void*) dest, source, bytes / 4);
+    } else {
+        memcpy16_dma((unsigned short*) dest, (unsigned short*) source, bytes / 2);
+    }
+}
+
+/* forget what has been uploaded */
+void layer_reset() {
+    for (int i = 0; i < 4; i++) {
+        layer_char_blocks[i] = 0;
+        layer_tiles_used[i] = 0;
+    }
+    layer_screen_blocks = 0;
+    for (int i = 0; i < 16; i++) {
+        layer_palettes[i] = 0;
+    }
+}
+
+/* upload a tileset's palette unless it is already there */
+static void layer_load_palette(const struct Tileset* tileset, int bank) {
+    if (tileset->colors == 256) {
+        /* a 256 color palette fills every bank */
+        int loaded = 1;
+        for (int i = 0; i < 16; i++) {
+            if (layer_palettes[i] != tileset->palette) {
+                loaded = 0;
+            }
+        }
+        if (loaded) {
+            return;
+        }
+        layer_copy(background_palette, tileset->palette, PALETTE_SIZE * 2);
+        for (int i = 0; i < 16; i++) {
+            layer_palettes[i] = tileset->palette;
+        }
+    } else {
+        if (layer_palettes[bank] == tileset->palette) {
+            return;
+        }
+        layer_copy(background_palette + bank * 16, tileset->palette, 16 * 2);
+        layer_palettes[bank] = tileset->palette;
+    }
+}
+
+/* upload a tileset and its palette, unless they are already there */
+void layer_load_tiles(const struct Tileset* tileset, int block, int palette_bank) {
+    layer_load_palette(tileset, palette_bank);
+
+    if (layer_char_blocks[block] != tileset) {
+        layer_copy(char_block(block), tileset->data, tileset->size);
+        layer_char_blocks[block] = tileset;
+
+        /* a big tileset runs on into the blocks after its own */
+        int tiles = (tileset->size + 31) / 32;
+        for (int i = block; i < 4 && tiles > 0; i++) {
+            int used = tiles < LAYER_BLOCK_TILES ? tiles : LAYER_BLOCK_TILES;
+            if (used > layer_tiles_used[i]) {
+                layer_tiles_used[i] = used;
+            }
+            tiles -= LAYER_BLOCK_TILES;
+        }
+    }
+}
+
+/* mark screen blocks as holding a map */
+void layer_reserve_screen_blocks(int block, int count) {
+    for (int i = block; i < block + count && i < 32; i++) {
+        layer_screen_blocks |= 1u << i;
+    }
+}
+
+/* hand out tiles from what is left of a char block, up to the first
+ * screen block in it which holds a map */
+int layer_alloc_tiles(int block, int tiles) {
+    int first = layer_tiles_used[block];
+    int limit = LAYER_BLOCK_TILES;
+    for (int i = 0; i < LAYER_BLOCK_TILES / LAYER_SCREEN_TILES; i++) {
+        if (layer_screen_blocks & (1u << (block * 8 + i))) {
+            limit = i * LAYER_SCREEN_TILES;
+            break;
+        }
+    }
+
+    if (first + tiles > limit) {
+        return -1;
+    }
+    layer_tiles_used[block] = first + tiles;
+    return first;
+}
+
+/* upload a layer's map into its screen blocks, a map which is the width of
+ * a screen block goes in one copy, a wider one a row of each block at a
+ * time, and any of the layer the map does not cover is left alone */
+static void layer_load_map(const struct Layer* layer) {
+    int width = layer->map_width < layer_widths[layer->size] ?
+        layer->map_width : layer_widths[layer->size];
+    int height = layer->map_height < layer_heights[layer->size] ?
+        layer->map_height : layer_heights[layer->size];
+
+    /* the blocks are numbered across then down, so a 256x512 layer has its
+     * bottom half in the next block and a 512x512 one two blocks on */
+    int blocks_across = layer_widths[layer->size] / 32;
+
+    if (layer->map_width == 32) {
+        for (int top = 0; top < height; top += 32) {
+            int rows = height - top < 32 ? height - top : 32;
+            layer_copy(screen_block(layer->screen_block + (top / 32) * blocks_across),
+                    layer->map + top * 32, rows * 32 * 2);
+        }
+        return;
+    }
+
+    for (int y = 0; y < height; y++) {
+        for (int left = 0; left < width; left += 32) {
+            int block = layer->screen_block + (y / 32) * blocks_across + left / 32;
+            int columns = width - left < 32 ? width - left : 32;
+            layer_copy(screen_block(block) + (y & 31) * 32,
+                    layer->map + y * layer->map_width + left, columns * 2);
+        }
+    }
+}
+
+/* upload a layer's tiles, palette and map, and set its control register */
+void layer_load(const struct Layer* layer) {
+    volatile unsigned short* controls[4] = {
+        bg0_control, bg1_control, bg2_control, bg3_control
+    };
+    const struct Tileset* tileset = layer->tileset;
+
+    layer_load_tiles(tileset, layer->char_block, layer->palette_bank);
+    layer_reserve_screen_blocks(layer->screen_block,
+            (layer_widths[layer->size] / 32) * (layer_heights[layer->size] / 32));
+
+    /* 16 color maps pick their palette bank in the top four bits of each
+     * entry, which the map data is expected to have already */
+    layer_load_map(layer);
+
+    *controls[layer->bg] = layer->priority |    /* priority, 0 is highest, 3 is lowest */
+        (layer->char_block << 2) |              /* the char block the image data is stored in */
+        (0 << 6) |                              /* the mosaic flag */
+        ((tileset->colors == 256) << 7) |       /* color mode, 0 is 16 colors, 1 is 256 colors */
+        (layer->screen_block << 8) |            /* the screen block the tile data is stored in */
+        (1 << 13) |                             /* wrapping flag */
+        (layer->size << 14);                    /* bg size */
+}
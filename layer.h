@@ -0,0 +1,88 @@
+/*
+ * layer.h
+ * the tile layers, each is described by a Layer which says which tiles,
+ * map and palette it uses and where they go in VRAM, loading a layer only
+ * uploads what is not already there, so layers sharing a tileset or a
+ * palette only load it once
+ */
+
+#ifndef LAYER_H
+#define LAYER_H
+
+#include "gba.h"
+
+/* the image data for the tiles and the palette which goes with it, colors
+ * is 16 or 256 */
+struct Tileset {
+    const void* data;
+    unsigned int size;
+    const unsigned short* palette;
+    int colors;
+};
+
+/* the sizes a text layer can be, in pixels, the map of a layer wider or
+ * taller than 256 pixels takes two or four screen blocks in a row, each
+ * holding a 32x32 tile square, left to right and then top to bottom */
+enum LayerSize {
+    LAYER_256_256,
+    LAYER_512_256,
+    LAYER_256_512,
+    LAYER_512_512
+};
+
+/* everything needed to set up one of the four tile layers */
+struct Layer {
+    /* the layer this is, 0 to 3 */
+    int bg;
+
+    /* the tiles, and the map of them which is width by height tiles, it
+     * is laid out row by row across the whole map and is split up into
+     * screen blocks when it is uploaded */
+    const struct Tileset* tileset;
+    const unsigned short* map;
+    int map_width;
+    int map_height;
+
+    /* the palette bank for 16 color tilesets, 256 color ones use them all */
+    int palette_bank;
+
+    /* where the tiles and the map go in VRAM */
+    int char_block;
+    int screen_block;
+
+    /* 0 is drawn on top, 3 underneath */
+    int priority;
+    enum LayerSize size;
+};
+
+/* forget what has been uploaded, so the next loads upload everything, this
+ * goes at the start of a level */
+void layer_reset();
+
+/* the width and height in tiles of each layer size */
+extern const unsigned char layer_widths[4];
+extern const unsigned char layer_heights[4];
+
+/* copy into VRAM a word at a time if both ends are word aligned, and a
+ * halfword at a time if not */
+void layer_copy(volatile unsigned short* dest, const void* source, unsigned int bytes);
+
+/* upload a tileset into a char block and its palette into a palette bank,
+ * unless they are already there */
+void layer_load_tiles(const struct Tileset* tileset, int block, int palette_bank);
+
+/* mark count screen blocks from block on as holding a map, layer_load does
+ * this for the layer's own, and anything else which puts a map in VRAM
+ * should too, layer_reset gives them all back */
+void layer_reserve_screen_blocks(int block, int count);
+
+/* hand out tiles from the part of a char block which no tileset was loaded
+ * into, counted in 32 byte 16 color tiles, they stop at the first screen
+ * block in the char block which holds a map, returns the first or -1 if
+ * there is not room, layer_reset gives them all back */
+int layer_alloc_tiles(int block, int tiles);
+
+/* upload a layer's tiles, palette and map, and set its control register */
+void layer_load(const struct Layer* layer);
+
+#endif
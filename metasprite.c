@@ -0,0 +1,33 @@
+/*
+ * metasprite.c
+ * drawing actors made of several hardware sprites
+ */
+
+#include "gba.h"
+#include "sprite.h"
+#include "metasprite.h"
+
+/* draw a metasprite into a run of sprites starting at dest */
+IWRAM_CODE int metasprite_draw(struct Sprite* dest, const struct MetaSprite* meta,
+        int x, int y, int horizontal_flip, int vertical_flip, int priority) {
+    const struct MetaPart* part = meta->parts;
+
+    /* the flip bits go on every part, and pick which offsets to use, so
+     * the loop below is the same either way */
+    int h = horizontal_flip ? 1 : 0;
+    int v = vertical_flip ? 1 : 0;
+    unsigned short flips = (h << 12) | (v << 13);
+    unsigned short attribute2 = priority << 10;
+
+    for (int i = 0; i < meta->count; i++, part++) {
+        int px = x + part->x[h];
+        int py = y + part->y[v];
+
+        dest[i].attribute0 = part->attribute0 | (py & 0xff);
+        dest[i].attribute1 = part->attribute1 | flips | (px & 0x1ff);
+        dest[i].attribute2 = part->tile | attribute2;
+    }
+
+    sprite_dirty = 1;
+    return meta->count;
+}
@@ -0,0 +1,36 @@
+/*
+ * metasprite.h
+ * metasprites are actors made of several hardware sprites, for anything
+ * bigger than 64x64 or not rectangular, the parts are made from
+ * metasprites.txt by the mkmeta tool into metasprites.h
+ */
+
+#ifndef METASPRITE_H
+#define METASPRITE_H
+
+#include "sprite.h"
+
+/* one hardware sprite in a metasprite, the attribute bits for its shape,
+ * size and color mode are worked out ahead of time, along with where it goes
+ * both normally (index 0) and when the whole metasprite is flipped (index 1) */
+struct MetaPart {
+    unsigned short attribute0;
+    unsigned short attribute1;
+    unsigned short tile;
+    short x[2];
+    short y[2];
+};
+
+/* a metasprite is a list of parts and the size of the box around them */
+struct MetaSprite {
+    const struct MetaPart* parts;
+    unsigned short count;
+    unsigned short width, height;
+};
+
+/* draw a metasprite into a run of sprites starting at dest, the flips apply
+ * to the whole metasprite, returns the number of sprites used */
+IWRAM_CODE int metasprite_draw(struct Sprite* dest, const struct MetaSprite* meta,
+        int x, int y, int horizontal_flip, int vertical_flip, int priority);
+
+#endif
@@ -0,0 +1,12 @@
+/* metasprites.h
+ * generated by mkmeta program */
+
+const struct MetaPart koopa_pair_parts [] = {
+    {0x2000, 0x8000, 0, {0, 32}, {0, 0}},
+    {0x2000, 0x8000, 16, {32, 0}, {0, 0}},
+};
+
+const struct MetaSprite koopa_pair = {
+    koopa_pair_parts, 2, 64, 32
+};
+
@@ -0,0 +1,129 @@
+
+/*
+ * mode7.c
+ * flying low over a floor in mode 1, the floor is an affine layer whose
+ * matrix is changed on every line by hblank DMA, with the sky behind it
+ */
+
+/* include these files */
+#include "gba.h"
+#include "input.h"
+#include "profile.h"
+#include "vblank.h"
+#include "layer.h"
+#include "affine.h"
+#include "bg.h"
+#include "map.h"
+#include "floor.h"
+
+/* the line the floor starts below */
+#define HORIZON 56
+
+/* the tiles the sky and the floor are both made from, the floor only uses
+ * the first 256 of them */
+const struct Tileset bg_tileset = {
+    bg_data, bg_width * bg_height, bg_palette, 256
+};
+
+/* the sky, behind the floor */
+const struct Layer sky = {
+    0,                      /* the layer */
+    &bg_tileset, map, map_width, map_height,
+    0,                      /* palette bank */
+    0, 16,                  /* char and screen block */
+    1,                      /* priority */
+    LAYER_256_256
+};
+
+/* the floor, on bg2 with its map in screen block 24 past the end of the
+ * tiles, it does not wrap so the sky shows past its edges */
+const struct AffineLayer floor_layer = {
+    2,                      /* the layer */
+    &bg_tileset, floor_map,
+    0, 24,                  /* char and screen block */
+    0,                      /* priority */
+    AFFINE_512,
+    0                       /* wrap */
+};
+
+/* the vblank task which turns the sky with the camera */
+void sky_task(void* data) {
+    *bg0_x_scroll = *(int*) data;
+}
+
+/* the main function */
+int main() {
+    /* we set the mode to mode 1 with the sky on bg0 and the floor on bg2 */
+    *display_control = MODE1 | BG0_ENABLE | BG2_ENABLE;
+
+    /* setup the layers, which share their tiles */
+    layer_reset();
+    layer_load(&sky);
+    affine_load(&floor_layer);
+
+    /* start in the middle of the floor */
+    struct Mode7 camera;
+    camera.x = (floor_size * 8 / 2) << 8;
+    camera.y = (floor_size * 8 / 2) << 8;
+    camera.height = 24;
+    camera.angle = 0;
+    camera.horizon = HORIZON;
+    int sky_scroll = 0;
+
+    /* choose between the keypad and a recorded session */
+    input_init();
+
+    /* start timing the frames */
+    profile_init();
+
+    /* loop until the input runs out, which is never on the hardware */
+    while (input_poll()) {
+        profile_begin(PROFILE_FRAME);
+
+        /* left and right turn, and the camera always moves forward, half a
+         * pixel a frame */
+        profile_begin(PROFILE_INPUT);
+        if (button_pressed(BUTTON_RIGHT)) {
+            camera.angle = (camera.angle + 1) & 0xff;
+        }
+        if (button_pressed(BUTTON_LEFT)) {
+            camera.angle = (camera.angle - 1) & 0xff;
+        }
+        profile_end(PROFILE_INPUT);
+
+        profile_begin(PROFILE_UPDATE);
+        camera.x += affine_sin[camera.angle] >> 5;
+        camera.y -= affine_cos(camera.angle) >> 5;
+
+        /* keep the camera over the floor */
+        int edge = (floor_size * 8) << 8;
+        if (camera.x < 0) {
+            camera.x = 0;
+        } else if (camera.x > edge) {
+            camera.x = edge;
+        }
+        if (camera.y < 0) {
+            camera.y = 0;
+        } else if (camera.y > edge) {
+            camera.y = edge;
+        }
+
+        /* the sky goes round once for each turn */
+        sky_scroll = camera.angle * 2;
+        mode7_build(&camera);
+        profile_end(PROFILE_UPDATE);
+
+        vblank_add(mode7_task, (void*) bg2_affine, 0, VBLANK_CRITICAL);
+        vblank_add(sky_task, &sky_scroll, 1, VBLANK_CRITICAL);
+        profile_end(PROFILE_FRAME);
+
+        /* wait for vblank before starting the next frame's lines */
+        wait_vblank();
+        profile_begin(PROFILE_VBLANK);
+        vblank_run();
+        profile_end(PROFILE_VBLANK);
+        profile_frame();
+    }
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * music.c
+ * the music player
+ */
+
+#include "gba.h"
+#include "profile.h"
+#include "music.h"
+
+#ifdef HOST
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* the note which stops a channel */
+#define NOTE_OFF 0xff
+
+/* the number of cycles of the 131072 Hz sound clock in one period of each
+ * note of the second octave, each octave up halves it, the frequency
+ * registers take 2048 minus the period */
+static const unsigned short music_periods[12] = {
+    2004, 1891, 1785, 1685, 1591, 1501, 1417, 1337, 1262, 1192, 1125, 1062
+};
+
+/* the song playing, where it is up to in the order and in the pattern, the
+ * frames left in this row and the empty rows left after it */
+static const struct Song* music_song = 0;
+static int music_position = 0;
+static const unsigned char* music_row = 0;
+static int music_timer = 0;
+static int music_empty = 0;
+
+#ifdef HOST
+/* the number of rows played, for the report */
+static unsigned int music_rows = 0;
+
+/* print the song's size when the program exits */
+static void music_report() {
+    if (music_song != 0) {
+        fprintf(stderr, "music: %s is %d bytes of ROM, %u rows played\n",
+                music_song->name, music_song->size, music_rows);
+    }
+}
+#endif
+
+/* turn on the PSG channels the songs use */
+void music_init() {
+    *sound_master = SOUND_ENABLE;
+    *sound_control = SOUND_PSG_VOLUME(7, 7) |
+        SOUND_PSG_LEFT(SOUND_SQUARE1 | SOUND_SQUARE2 | SOUND_NOISE) |
+        SOUND_PSG_RIGHT(SOUND_SQUARE1 | SOUND_SQUARE2 | SOUND_NOISE);
+    *sound_direct |= SOUND_PSG_FULL;
+
+    /* square 1's sweep is turned off */
+    *sound_square1_sweep = 0x0008;
+
+#ifdef HOST
+    atexit(music_report);
+#endif
+}
+
+/* start a song from the beginning */
+void music_play(const struct Song* song) {
+    music_song = song;
+    music_position = 0;
+    music_row = song->patterns + song->pattern_offsets[song->order[0]];
+    music_timer = 1;
+    music_empty = 0;
+}
+
+/* stop the music */
+void music_stop() {
+    music_song = 0;
+    *sound_square1_envelope = 0;
+    *sound_square1_frequency = SOUND_RESTART;
+    *sound_square2_envelope = 0;
+    *sound_square2_frequency = SOUND_RESTART;
+    *sound_noise_envelope = 0;
+    *sound_noise_frequency = SOUND_RESTART;
+}
+
+/* start or stop a note on a channel */
+static void music_note(int channel, int note, int instrument) {
+    unsigned short envelope = note == NOTE_OFF ? 0 : music_song->instruments[instrument];
+
+    if (channel == 2) {
+        /* the noise is clocked faster for higher notes, by a shift for each
+         * octave and a divider within it */
+        int shift = 13 - note / 8;
+        if (shift < 0) {
+            shift = 0;
+        }
+        *sound_noise_envelope = envelope;
+        *sound_noise_frequency = (7 - (note & 7)) | (shift << 4) | SOUND_RESTART;
+        return;
+    }
+
+    int octave = note / 12;
+    int rate = 2048 - (music_periods[note % 12] >> (octave < 2 ? 0 : octave - 2));
+    if (channel == 0) {
+        *sound_square1_envelope = envelope;
+        *sound_square1_frequency = rate | SOUND_RESTART;
+    } else {
+        *sound_square2_envelope = envelope;
+        *sound_square2_frequency = rate | SOUND_RESTART;
+    }
+}
+
+/* set how loud the music is, the PSG master volume only has 8 steps */
+void music_volume(int volume) {
+    int level = volume > 16 ? 7 : (volume * 7 + 8) / 16;
+    *sound_control = (*sound_control & ~SOUND_PSG_VOLUME(7, 7)) | SOUND_PSG_VOLUME(level, level);
+}
+
+/* play the next frame of the song */
+void music_update() {
+    if (music_song == 0 || --music_timer != 0) {
+        return;
+    }
+    profile_begin(PROFILE_MUSIC);
+    music_timer = music_song->speed;
+#ifdef HOST
+    music_rows++;
+#endif
+
+    if (music_empty > 0) {
+        music_empty--;
+        profile_end(PROFILE_MUSIC);
+        return;
+    }
+
+    /* move on to the next pattern in the order at the end of this one */
+    if (*music_row == 0) {
+        music_position++;
+        if (music_position == music_song->order_length) {
+            music_position = 0;
+        }
+        music_row = music_song->patterns +
+            music_song->pattern_offsets[music_song->order[music_position]];
+    }
+
+    int mask = *music_row++;
+    if (mask & 0x80) {
+        /* this row starts a run of empty ones */
+        music_empty = (mask & 0x7f) - 1;
+    } else {
+        for (int channel = 0; channel < 3; channel++) {
+            if (mask & (1 << channel)) {
+                music_note(channel, music_row[0], music_row[1]);
+                music_row += 2;
+            }
+        }
+    }
+    profile_end(PROFILE_MUSIC);
+}
@@ -0,0 +1,45 @@
+/*
+ * music.h
+ * a tracker style music player on the PSG channels, songs are made from
+ * text by the mksong tool into tables which are read straight out of ROM a
+ * row at a time, so nothing is unpacked into RAM
+ */
+
+#ifndef MUSIC_H
+#define MUSIC_H
+
+/* a song as mksong writes it, the instruments are the envelope register
+ * values, and the patterns are packed one after another */
+struct Song {
+    const char* name;
+    const unsigned short* instruments;
+    const unsigned char* patterns;
+    const unsigned short* pattern_offsets;
+    const unsigned char* order;
+    unsigned short order_length;
+
+    /* the number of frames each row lasts */
+    unsigned char speed;
+
+    /* the size of all of the tables in bytes */
+    unsigned short size;
+};
+
+/* turn on the PSG channels the songs use */
+void music_init();
+
+/* start a song from the beginning, it loops back to the start of its order
+ * when it gets to the end */
+void music_play(const struct Song* song);
+
+/* stop the music and silence the channels */
+void music_stop();
+
+/* set how loud the music is, from 0 for silent to 16 for full, which is
+ * what the settings in the save record hold */
+void music_volume(int volume);
+
+/* play the next frame of the song, this is called once a frame */
+void music_update();
+
+#endif
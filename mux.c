@@ -0,0 +1,325 @@
+/*
+ * mux.c
+ * the sprite multiplexer
+ *
+ * the sprites are sorted by their top line and dealt out to the OAM entries,
+ * the first round goes into the shadow OAM which is copied over in vblank,
+ * and each later sprite goes to the entry which comes free first and is
+ * written into it by the vcount interrupt on the line after the entry's
+ * last sprite finished, as long as that is at least two lines before it
+ * starts (the hardware reads the sprites for a line during the line before)
+ */
+
+#include "gba.h"
+#include "interrupt.h"
+#include "sprite.h"
+#include "vblank.h"
+#include "mux.h"
+
+#ifdef HOST
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* the sprites to show this frame */
+struct Sprite mux_sprites[MUX_MAX_SPRITES];
+int mux_count = 0;
+
+/* the pressure on each line */
+unsigned char mux_line_sprites[SCREEN_HEIGHT];
+unsigned short mux_line_cycles[SCREEN_HEIGHT];
+int mux_over_lines = 0;
+int mux_dropped = 0;
+
+/* an OAM entry to rewrite part way down the screen */
+struct MuxWrite {
+    unsigned short line;
+    unsigned short slot;
+    unsigned short attribute0;
+    unsigned short attribute1;
+    unsigned short attribute2;
+};
+
+/* the schedule being built and the one the interrupt is working through,
+ * they swap in vblank */
+static struct MuxWrite mux_writes[2][MUX_MAX_SPRITES];
+static int mux_write_count[2];
+static int mux_back = 0;
+static struct MuxWrite* volatile mux_front = mux_writes[1];
+static volatile int mux_front_count = 0;
+static volatile int mux_next = 0;
+
+/* the first OAM entry the multiplexer owns */
+static int mux_first_slot = 0;
+
+/* the sprites sorted by their top line, and the lines they cover */
+static unsigned char mux_order[MUX_MAX_SPRITES];
+static short mux_top[MUX_MAX_SPRITES];
+static short mux_bottom[MUX_MAX_SPRITES];
+
+/* the lines a sprite can start on go from 64 above the screen to the bottom */
+#define MUX_TOP_LINES (SCREEN_HEIGHT + 64)
+
+/* the scanline the vcount interrupt is set to when there is nothing to do */
+#define MUX_NO_LINE 255
+
+#ifdef HOST
+/* the worst pressure seen, for the report */
+static int mux_peak_sprites = 0;
+static int mux_peak_cycles = 0;
+static int mux_total_over_lines = 0;
+static int mux_total_dropped = 0;
+static int mux_total_held = 0;
+
+/* print the pressure when the program exits */
+static void mux_report() {
+    fprintf(stderr, "mux: peak %d sprites and %d of %d cycles on a line, "
+            "%d lines over, %d sprites dropped, %d frames held\n", mux_peak_sprites,
+            mux_peak_cycles, MUX_LINE_CYCLES, mux_total_over_lines, mux_total_dropped,
+            mux_total_held);
+}
+#endif
+
+/* the vcount interrupt, which writes the entries due on this line and sets
+ * up the next one */
+IWRAM_CODE static void mux_vcount() {
+    int line;
+    do {
+        line = *scanline_counter;
+        while (mux_next < mux_front_count && mux_front[mux_next].line <= line) {
+            struct MuxWrite* write = &mux_front[mux_next];
+            volatile unsigned short* oam = sprite_attribute_memory + write->slot * 4;
+            oam[0] = write->attribute0;
+            oam[1] = write->attribute1;
+            oam[2] = write->attribute2;
+            mux_next++;
+        }
+
+        if (mux_next >= mux_front_count) {
+            interrupt_set_vcount(MUX_NO_LINE);
+            return;
+        }
+        interrupt_set_vcount(mux_front[mux_next].line);
+
+        /* if the line went by while writing, do it now rather than wait a
+         * whole frame for the interrupt */
+    } while (*scanline_counter >= mux_front[mux_next].line);
+}
+
+/* the vblank task which swaps in the new schedule */
+static void mux_swap_task(void* data) {
+    mux_front = mux_writes[mux_back];
+    mux_front_count = mux_write_count[mux_back];
+    mux_next = 0;
+    mux_back ^= 1;
+
+    interrupt_set_vcount(mux_front_count > 0 ? mux_front[0].line : MUX_NO_LINE);
+}
+
+/* take over the OAM entries from next_sprite_index up */
+void mux_init() {
+    mux_first_slot = next_sprite_index;
+    next_sprite_index = NUM_SPRITES;
+
+    /* the entries are rewritten in place, so sorting must not move them */
+    sprite_sort_keep(mux_first_slot);
+
+    *display_control |= HBLANK_OAM;
+    interrupt_set_vcount(MUX_NO_LINE);
+    interrupt_set(INT_VCOUNT, mux_vcount);
+
+#ifdef HOST
+    atexit(mux_report);
+#endif
+}
+
+/* empty the list of sprites */
+void mux_clear() {
+    mux_count = 0;
+}
+
+/* add a sprite to the list, returns 0 when it is full */
+struct Sprite* mux_add() {
+    if (mux_count >= MUX_MAX_SPRITES) {
+        return 0;
+    }
+    return &mux_sprites[mux_count++];
+}
+
+/* move the slot at the top of a heap down until it frees no later than
+ * the ones below it */
+static void mux_sift_down(unsigned char* heap, int size, const short* slot_free) {
+    int i = 0;
+    int slot = heap[0];
+    while (1) {
+        int child = i * 2 + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && slot_free[heap[child + 1]] < slot_free[heap[child]]) {
+            child++;
+        }
+        if (slot_free[heap[child]] >= slot_free[slot]) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = slot;
+}
+
+/* sort the sprites and work out which OAM entry to put each in and when */
+void mux_build() {
+    static unsigned short counts[MUX_TOP_LINES + 1];
+    static short sprite_delta[SCREEN_HEIGHT + 1];
+    static short cycle_delta[SCREEN_HEIGHT + 1];
+    static short slot_free[NUM_SPRITES];
+    static unsigned char heap[NUM_SPRITES];
+    int visible = 0;
+
+    for (int i = 0; i <= MUX_TOP_LINES; i++) {
+        counts[i] = 0;
+    }
+    for (int i = 0; i <= SCREEN_HEIGHT; i++) {
+        sprite_delta[i] = 0;
+        cycle_delta[i] = 0;
+    }
+
+    /* find the lines each sprite covers, and count how many start on each
+     * line for the sort, a y past the bottom of the screen wraps around to
+     * above the top */
+    for (int i = 0; i < mux_count; i++) {
+        unsigned short a0 = mux_sprites[i].attribute0;
+        unsigned short a1 = mux_sprites[i].attribute1;
+        int shape = a0 >> 14;
+        int size = a1 >> 14;
+        int top = a0 & 0xff;
+        if (top >= SCREEN_HEIGHT) {
+            top -= 256;
+        }
+        int bottom = top + sprite_heights[shape][size];
+
+        mux_top[i] = top;
+        mux_bottom[i] = bottom;
+        if (bottom <= 0 || top >= SCREEN_HEIGHT || top < -64) {
+            continue;
+        }
+        counts[top + 64 + 1]++;
+
+        /* the pressure is counted with a running total over the lines */
+        int first = top < 0 ? 0 : top;
+        int last = bottom > SCREEN_HEIGHT ? SCREEN_HEIGHT : bottom;
+        sprite_delta[first]++;
+        sprite_delta[last]--;
+        cycle_delta[first] += sprite_widths[shape][size];
+        cycle_delta[last] -= sprite_widths[shape][size];
+        visible++;
+    }
+
+    /* a counting sort on the top line keeps sprites which start on the same
+     * line in the order they were added */
+    for (int i = 1; i <= MUX_TOP_LINES; i++) {
+        counts[i] += counts[i - 1];
+    }
+    for (int i = 0; i < mux_count; i++) {
+        int top = mux_top[i];
+        if (mux_bottom[i] <= 0 || top >= SCREEN_HEIGHT || top < -64) {
+            continue;
+        }
+        mux_order[counts[top + 64]++] = i;
+    }
+
+    /* add up the pressure on each line */
+    int sprites_on_line = 0, cycles_on_line = 0;
+    mux_over_lines = 0;
+    for (int line = 0; line < SCREEN_HEIGHT; line++) {
+        sprites_on_line += sprite_delta[line];
+        cycles_on_line += cycle_delta[line];
+        mux_line_sprites[line] = sprites_on_line;
+        mux_line_cycles[line] = cycles_on_line;
+        if (cycles_on_line > MUX_LINE_CYCLES) {
+            mux_over_lines++;
+        }
+#ifdef HOST
+        if (sprites_on_line > mux_peak_sprites) {
+            mux_peak_sprites = sprites_on_line;
+        }
+        if (cycles_on_line > mux_peak_cycles) {
+            mux_peak_cycles = cycles_on_line;
+        }
+#endif
+    }
+
+    /* the new schedule and the shadow OAM only go in together with the
+     * swap, so if the queue has no room for it the last frame's are left
+     * as they are, since they still match */
+    if (!vblank_add(mux_swap_task, 0, 0, VBLANK_CRITICAL)) {
+#ifdef HOST
+        mux_total_held++;
+#endif
+        return;
+    }
+
+    /* deal the sprites out to the OAM entries, each to the one which comes
+     * free first, kept at the top of a heap ordered by the line each entry's
+     * last sprite ends on */
+    int slots = NUM_SPRITES - mux_first_slot;
+    struct MuxWrite* writes = mux_writes[mux_back];
+    int count = 0;
+    mux_dropped = 0;
+
+    for (int k = 0; k < visible; k++) {
+        int i = mux_order[k];
+
+        if (k < slots) {
+            /* the first round is copied over in vblank, and each entry is
+             * sifted up into the heap */
+            sprites[mux_first_slot + k] = mux_sprites[i];
+            slot_free[k] = mux_bottom[i];
+            int j = k;
+            while (j > 0 && slot_free[heap[(j - 1) / 2]] > slot_free[k]) {
+                heap[j] = heap[(j - 1) / 2];
+                j = (j - 1) / 2;
+            }
+            heap[j] = k;
+            continue;
+        }
+
+        int slot = heap[0];
+        if (slot_free[slot] + 2 <= mux_top[i]) {
+            /* later ones are written once the entry is free, in order of
+             * line, which they nearly are already */
+            int j = count++;
+            while (j > 0 && writes[j - 1].line > slot_free[slot]) {
+                writes[j] = writes[j - 1];
+                j--;
+            }
+            writes[j].line = slot_free[slot];
+            writes[j].slot = mux_first_slot + slot;
+            writes[j].attribute0 = mux_sprites[i].attribute0;
+            writes[j].attribute1 = mux_sprites[i].attribute1;
+            writes[j].attribute2 = mux_sprites[i].attribute2;
+        } else {
+            /* even the entry which comes free first is still drawing when
+             * this sprite starts */
+            mux_dropped++;
+            continue;
+        }
+        slot_free[slot] = mux_bottom[i];
+        mux_sift_down(heap, slots, slot_free);
+    }
+
+    /* hide the entries nothing was dealt to */
+    for (int slot = visible; slot < slots; slot++) {
+        sprites[mux_first_slot + slot].attribute0 = SCREEN_HEIGHT;
+        sprites[mux_first_slot + slot].attribute1 = SCREEN_WIDTH;
+    }
+
+#ifdef HOST
+    mux_total_over_lines += mux_over_lines;
+    mux_total_dropped += mux_dropped;
+#endif
+
+    mux_write_count[mux_back] = count;
+    sprite_dirty = 1;
+}
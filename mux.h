@@ -0,0 +1,49 @@
+/*
+ * mux.h
+ * the sprite multiplexer, which shows more than the 128 sprites the hardware
+ * has by sorting them by y and rewriting OAM entries part way down the
+ * screen, once the sprite which was in an entry has finished drawing
+ */
+
+#ifndef MUX_H
+#define MUX_H
+
+#include "sprite.h"
+
+/* the most sprites the multiplexer can show */
+#define MUX_MAX_SPRITES 256
+
+/* the sprite pixels the hardware can draw on one line, which is smaller
+ * than usual since OAM is left open during hblank */
+#define MUX_LINE_CYCLES 954
+
+/* the sprites to show this frame, which are set up the same way as the
+ * hardware ones */
+extern struct Sprite mux_sprites[MUX_MAX_SPRITES];
+extern int mux_count;
+
+/* the pressure on each line from the last mux_build, the number of sprites
+ * on the line and the number of cycles the hardware needs to draw them */
+extern unsigned char mux_line_sprites[SCREEN_HEIGHT];
+extern unsigned short mux_line_cycles[SCREEN_HEIGHT];
+
+/* the number of lines over MUX_LINE_CYCLES, and the number of sprites which
+ * could not be given an OAM entry in time, in the last mux_build */
+extern int mux_over_lines;
+extern int mux_dropped;
+
+/* take over the OAM entries from next_sprite_index up and set up the vcount
+ * interrupt, interrupt_init has to be called first */
+void mux_init();
+
+/* empty the list of sprites, and add one to it */
+void mux_clear();
+struct Sprite* mux_add();
+
+/* sort the sprites and work out which OAM entry to put each in and when,
+ * this goes before wait_vblank, and queues the vblank task which swaps in
+ * the new schedule, if the vblank queue is full the last frame's sprites
+ * are shown again */
+void mux_build();
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ * palette.c
+ * the RAM copy of the palettes, fading and color cycling
+ */
+
+#include "gba.h"
+#include "palette.h"
+
+/* the colors as they were loaded and as they are shown, word aligned so
+ * they can be worked on two at a time */
+unsigned short palette_base[PALETTE_COLORS] __attribute__((aligned(4)));
+unsigned short palette_shadow[PALETTE_COLORS] __attribute__((aligned(4)));
+
+/* the range of entries which has changed since the last upload */
+static int palette_dirty_first = PALETTE_COLORS;
+static int palette_dirty_last = 0;
+
+/* the color being faded to and how far */
+static unsigned int palette_fade_pair = 0;
+static int palette_fade_level = 0;
+
+/* a range of colors being rotated */
+struct PaletteCycle {
+    unsigned short first;
+    unsigned short count;
+    unsigned char frames;
+    unsigned char timer;
+};
+static struct PaletteCycle palette_cycles[PALETTE_MAX_CYCLES];
+static int palette_cycle_count = 0;
+
+/* note that entries first up to last have changed */
+static inline void palette_touch(int first, int last) {
+    if (first < palette_dirty_first) {
+        palette_dirty_first = first;
+    }
+    if (last > palette_dirty_last) {
+        palette_dirty_last = last;
+    }
+}
+
+/* work out the shadow colors for a range of entries from the base ones and
+ * the fade, two colors at a time
+ *
+ * each 32-bit pair holds six 5-bit channels, which are split into two
+ * groups whose channels are at least 10 bits apart, then each channel can
+ * be multiplied by a weight of up to 32 without running into the next, so
+ * one multiply does three channels */
+#define PAIR_GROUP_1 0x03e07c1f
+#define PAIR_GROUP_2 0x03e0f81f
+IWRAM_CODE static void palette_blend(int first, int last) {
+    const unsigned int* from = (const unsigned int*) palette_base;
+    unsigned int* to = (unsigned int*) palette_shadow;
+    int level = palette_fade_level;
+
+    /* work on whole pairs */
+    first >>= 1;
+    last = (last + 1) >> 1;
+
+    if (level == 0) {
+        for (int i = first; i < last; i++) {
+            to[i] = from[i];
+        }
+    } else {
+        unsigned int fade_1 = (palette_fade_pair & PAIR_GROUP_1) * level;
+        unsigned int fade_2 = ((palette_fade_pair >> 5) & PAIR_GROUP_2) * level;
+        int keep = 32 - level;
+
+        for (int i = first; i < last; i++) {
+            unsigned int pair = from[i];
+            unsigned int group_1 = ((pair & PAIR_GROUP_1) * keep + fade_1) >> 5;
+            unsigned int group_2 = (((pair >> 5) & PAIR_GROUP_2) * keep + fade_2) >> 5;
+            to[i] = (group_1 & PAIR_GROUP_1) | ((group_2 & PAIR_GROUP_2) << 5);
+        }
+    }
+    palette_touch(first * 2, last * 2);
+}
+
+/* load colors into the palettes */
+void palette_load(int first, const unsigned short* colors, int count) {
+    for (int i = 0; i < count; i++) {
+        palette_base[first + i] = colors[i];
+    }
+    palette_blend(first, first + count);
+}
+
+/* change one color */
+void palette_set(int index, unsigned short color) {
+    palette_base[index] = color;
+    palette_blend(index, index + 1);
+}
+
+/* fade every color towards another one */
+IWRAM_CODE void palette_fade(unsigned short color, int level) {
+    if (level == palette_fade_level && (level == 0 || (palette_fade_pair & 0xffff) == color)) {
+        return;
+    }
+    palette_fade_pair = color | (color << 16);
+    palette_fade_level = level;
+    palette_blend(0, PALETTE_COLORS);
+}
+
+/* start rotating a range of colors */
+int palette_cycle(int first, int count, int frames) {
+    if (palette_cycle_count == PALETTE_MAX_CYCLES) {
+        return 0;
+    }
+    struct PaletteCycle* cycle = &palette_cycles[palette_cycle_count++];
+    cycle->first = first;
+    cycle->count = count;
+    cycle->frames = frames;
+    cycle->timer = frames;
+    return 1;
+}
+
+/* stop all of the color cycles */
+void palette_cycle_clear() {
+    palette_cycle_count = 0;
+}
+
+/* advance the color cycles by one frame */
+IWRAM_CODE void palette_update() {
+    for (int i = 0; i < palette_cycle_count; i++) {
+        struct PaletteCycle* cycle = &palette_cycles[i];
+        if (--cycle->timer != 0) {
+            continue;
+        }
+        cycle->timer = cycle->frames;
+
+        /* move each color up one, the last goes round to the first */
+        unsigned short* colors = &palette_base[cycle->first];
+        unsigned short last = colors[cycle->count - 1];
+        for (int j = cycle->count - 1; j > 0; j--) {
+            colors[j] = colors[j - 1];
+        }
+        colors[0] = last;
+        palette_blend(cycle->first, cycle->first + cycle->count);
+    }
+}
+
+/* the number of words the next upload will copy */
+int palette_pending() {
+    if (palette_dirty_first >= palette_dirty_last) {
+        return 0;
+    }
+    return (palette_dirty_last - palette_dirty_first) / 2;
+}
+
+/* copy the entries which changed into palette memory */
+void palette_upload() {
+    if (palette_dirty_first >= palette_dirty_last) {
+        return;
+    }
+
+    /* the range always starts and ends on a pair, so it goes a word at a
+     * time */
+    memcpy32_dma((void*) (background_palette + palette_dirty_first),
+            &palette_shadow[palette_dirty_first],
+            (palette_dirty_last - palette_dirty_first) / 2);
+    palette_dirty_first = PALETTE_COLORS;
+    palette_dirty_last = 0;
+}
+
+/* the vblank task which copies the changed entries */
+void palette_task(void* data) {
+    palette_upload();
+}
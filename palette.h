@@ -0,0 +1,55 @@
+/*
+ * palette.h
+ * a copy of the background and sprite palettes in RAM which fades and
+ * color cycling work on, only the entries which changed are copied over to
+ * the real palette in vblank, so nothing ever has to read palette memory
+ */
+
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include "gba.h"
+
+/* the background palette then the sprite palette */
+#define PALETTE_COLORS (PALETTE_SIZE * 2)
+
+/* the most color cycles at once */
+#define PALETTE_MAX_CYCLES 8
+
+/* the colors as they were loaded, with any cycling applied, and the colors
+ * with the fade applied too which get copied to palette memory, they are
+ * globals so on the hardware they are in IWRAM */
+extern unsigned short palette_base[PALETTE_COLORS];
+extern unsigned short palette_shadow[PALETTE_COLORS];
+
+/* load colors into the palettes, the first 256 entries are the background
+ * palette and the rest are the sprites */
+void palette_load(int first, const unsigned short* colors, int count);
+
+/* change one color */
+void palette_set(int index, unsigned short color);
+
+/* fade every color towards another one, level goes from 0 for none of it
+ * to 32 for all of it */
+IWRAM_CODE void palette_fade(unsigned short color, int level);
+
+/* rotate a range of colors by one entry every so many frames, returns 0 if
+ * there is no room for another cycle */
+int palette_cycle(int first, int count, int frames);
+
+/* stop all of the color cycles */
+void palette_cycle_clear();
+
+/* advance the color cycles by one frame */
+IWRAM_CODE void palette_update();
+
+/* copy the entries which changed into palette memory, in one DMA */
+void palette_upload();
+
+/* the number of words the next upload will copy, 0 if nothing changed */
+int palette_pending();
+
+/* the vblank task which copies the changed entries */
+void palette_task(void* data);
+
+#endif
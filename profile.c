@@ -0,0 +1,161 @@
+/*
+ * profile.c
+ * the per frame CPU profiler
+ *
+ * every PROFILE_DUMP_INTERVAL frames the statistics are written to SRAM as a
+ * 16 byte header followed by 16 bytes for each zone, so they can be read out
+ * of the .sav file after a run, the host shim prints them when it exits
+ */
+
+#include "gba.h"
+#include "profile.h"
+
+#ifdef HOST
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* how often the statistics are written to SRAM */
+#define PROFILE_DUMP_INTERVAL 256
+
+/* the dump header fields */
+#define PROFILE_MAGIC 0x464f5250   /* "PROF" */
+#define PROFILE_VERSION 2
+
+/* the dump header and the record for each zone as they sit in SRAM */
+struct ProfileHeader {
+    unsigned int magic;
+    unsigned short version;
+    unsigned short zones;
+    unsigned int frames;
+    unsigned int overruns;
+};
+struct ProfileRecord {
+    unsigned int min;
+    unsigned int average;
+    unsigned int max;
+    unsigned short start_line;
+    unsigned short reserved;
+};
+
+struct ProfileStats profile_stats[PROFILE_ZONES];
+
+/* the number of frames where work spilled past the end of vblank */
+unsigned int profile_overruns = 0;
+
+/* the names of each zone for the reports */
+const char* profile_names[PROFILE_ZONES] = {
+    "frame",
+    "input",
+    "update",
+    "collision",
+    "oam",
+    "vblank",
+    "sound",
+    "music"
+};
+
+/* the number of frames profiled */
+static unsigned int profile_frames = 0;
+
+#ifdef HOST
+/* print the statistics when the program exits */
+static void profile_report() {
+    fprintf(stderr, "cycles a frame in each zone, counted by the host shim's cost model\n");
+    fprintf(stderr, "%-10s %8s %8s %8s %6s\n", "zone", "min", "avg", "max", "line");
+    for (int i = 0; i < PROFILE_ZONES; i++) {
+        struct ProfileStats* s = &profile_stats[i];
+        if (s->frames == 0) {
+            continue;
+        }
+        fprintf(stderr, "%-10s %8u %8llu %8u %6u\n", profile_names[i], s->min,
+                s->total / s->frames, s->max, s->start_line);
+    }
+    fprintf(stderr, "%u frames, %u cycles per frame, %u vblank overruns\n",
+            profile_frames, CYCLES_PER_FRAME, profile_overruns);
+}
+#endif
+
+/* start the timers and clear the statistics */
+void profile_init() {
+    for (int i = 0; i < PROFILE_ZONES; i++) {
+        profile_stats[i].cycles = 0;
+        profile_stats[i].calls = 0;
+        profile_stats[i].min = 0xffffffff;
+        profile_stats[i].max = 0;
+        profile_stats[i].total = 0;
+        profile_stats[i].frames = 0;
+    }
+    profile_frames = 0;
+    profile_overruns = 0;
+
+    /* timer 3 counts each time timer 2 overflows, and timer 2 counts every
+     * cycle, together they make a 32-bit cycle counter, timers 0 and 1 are
+     * left for the sound */
+    *timer2_control = 0;
+    *timer3_control = 0;
+    *timer2_data = 0;
+    *timer3_data = 0;
+    *timer3_control = TIMER_ENABLE | TIMER_CASCADE;
+    *timer2_control = TIMER_ENABLE | TIMER_FREQ_1;
+
+#ifdef HOST
+    atexit(profile_report);
+#endif
+}
+
+/* fold this frame's zone timings into the statistics */
+void profile_frame() {
+    for (int i = 0; i < PROFILE_ZONES; i++) {
+        struct ProfileStats* s = &profile_stats[i];
+        if (s->calls == 0) {
+            continue;
+        }
+        if (s->cycles < s->min) {
+            s->min = s->cycles;
+        }
+        if (s->cycles > s->max) {
+            s->max = s->cycles;
+        }
+        s->total += s->cycles;
+        s->frames++;
+        s->cycles = 0;
+        s->calls = 0;
+    }
+
+    profile_frames++;
+    if ((profile_frames % PROFILE_DUMP_INTERVAL) == 0) {
+        profile_dump();
+    }
+}
+
+/* write the statistics to SRAM */
+void profile_dump() {
+    struct ProfileHeader header;
+    struct ProfileRecord record;
+    unsigned int offset = SRAM_PROFILE_OFFSET;
+
+    header.magic = PROFILE_MAGIC;
+    header.version = PROFILE_VERSION;
+    header.zones = PROFILE_ZONES;
+    header.frames = profile_frames;
+    header.overruns = profile_overruns;
+    sram_write(offset, &header, sizeof(header));
+    offset += sizeof(header);
+
+    for (int i = 0; i < PROFILE_ZONES; i++) {
+        struct ProfileStats* s = &profile_stats[i];
+        if (s->frames == 0) {
+            record.min = 0;
+            record.average = 0;
+        } else {
+            record.min = s->min;
+            record.average = s->total / s->frames;
+        }
+        record.max = s->max;
+        record.start_line = s->start_line;
+        record.reserved = 0;
+        sram_write(offset, &record, sizeof(record));
+        offset += sizeof(record);
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * profile.h
+ * a per frame CPU profiler built on timers 2 and 3 cascaded into one 32-bit
+ * cycle counter, code is wrapped in zones and each zone keeps the min,
+ * average and max number of cycles it used per frame
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "gba.h"
+
+#ifdef HOST
+#include "host.h"
+#endif
+
+/* the zones which code can be wrapped in */
+enum ProfileZone {
+    PROFILE_FRAME,
+    PROFILE_INPUT,
+    PROFILE_UPDATE,
+    PROFILE_COLLISION,
+    PROFILE_OAM,
+    PROFILE_VBLANK,
+    PROFILE_SOUND,
+    PROFILE_MUSIC,
+    PROFILE_ZONES
+};
+
+/* the statistics kept for each zone */
+struct ProfileStats {
+    /* the cycles used so far this frame and the times the zone was entered */
+    unsigned int cycles;
+    unsigned int calls;
+
+    /* the cycle count and scanline when the zone was last entered */
+    unsigned int start;
+    unsigned short start_line;
+
+    /* the fewest and most cycles used in a frame, and the total */
+    unsigned int min;
+    unsigned int max;
+    unsigned long long total;
+
+    /* the number of frames the zone was entered in */
+    unsigned int frames;
+};
+
+extern struct ProfileStats profile_stats[PROFILE_ZONES];
+
+/* the number of frames where work spilled past the end of vblank */
+extern unsigned int profile_overruns;
+
+/* the names of each zone for the reports */
+extern const char* profile_names[PROFILE_ZONES];
+
+/* start the timers and clear the statistics */
+void profile_init();
+
+/* read the cycle counter, the high half is read twice in case the low half
+ * overflowed in between */
+static inline unsigned int profile_cycles() {
+#ifdef HOST
+    return host_cycles();
+#else
+    unsigned short high = *timer3_data;
+    unsigned short low = *timer2_data;
+    if (*timer3_data != high) {
+        high = *timer3_data;
+        low = *timer2_data;
+    }
+    return (high << 16) | low;
+#endif
+}
+
+/* read the scanline being drawn */
+static inline unsigned short profile_scanline() {
+#ifdef HOST
+    return host_scanline();
+#else
+    return *scanline_counter;
+#endif
+}
+
+/* enter a zone */
+static inline void profile_begin(enum ProfileZone zone) {
+    profile_stats[zone].start_line = profile_scanline();
+    profile_stats[zone].start = profile_cycles();
+}
+
+/* leave a zone */
+static inline void profile_end(enum ProfileZone zone) {
+    profile_stats[zone].cycles += profile_cycles() - profile_stats[zone].start;
+    profile_stats[zone].calls++;
+}
+
+/* count a frame whose vblank work ran into the next frame */
+static inline void profile_overrun() {
+    profile_overruns++;
+}
+
+/* fold this frame's zone timings into the statistics, this is called once per
+ * frame and every so often it also dumps the statistics to SRAM */
+void profile_frame();
+
+/* write the statistics to SRAM */
+void profile_dump();
+
+#endif
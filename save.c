@@ -0,0 +1,406 @@
+/*
+ * save.c
+ * the save record in SRAM or Flash
+ *
+ * the record is stored as a 16 byte header followed by the SaveRecord, the
+ * header has a sequence number which goes up with each save and a checksum
+ * of the record, so the newest good copy is the one loaded, the body is
+ * written first and the header last so a write which is cut off part way
+ * never looks good
+ *
+ * on SRAM the record goes back and forth between two slots in the last 4K,
+ * and only the bytes which differ from what is already in the slot are
+ * written, on Flash a byte can only be written once after its sector is
+ * erased, and a sector only lasts about 10000 erases, so the record goes
+ * round the last four 4K sectors of the first 64K instead, the replay and
+ * profile dumps in the rest of SRAM are not kept on a Flash cartridge
+ */
+
+#include "gba.h"
+#include "save.h"
+
+#ifdef HOST
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* the header fields */
+#define SAVE_MAGIC 0x45564153   /* "SAVE" */
+#define SAVE_VERSION 1
+
+/* the header and the record as they sit in the backup memory */
+struct SaveHeader {
+    unsigned int magic;
+    unsigned short version;
+    unsigned short size;
+    unsigned int sequence;
+    unsigned int checksum;
+};
+struct SaveImage {
+    struct SaveHeader header;
+    struct SaveRecord record;
+};
+
+#define SAVE_HEADER_WORDS (sizeof(struct SaveHeader) / 4)
+#define SAVE_IMAGE_WORDS (sizeof(struct SaveImage) / 4)
+
+/* where the slots are for each kind of backup memory */
+#define SAVE_SRAM_SLOTS 2
+#define SAVE_SRAM_SLOT_SIZE (SRAM_SAVE_SIZE / SAVE_SRAM_SLOTS)
+#define SAVE_FLASH_SLOTS 4
+#define SAVE_FLASH_OFFSET 0xc000
+#define SAVE_FLASH_SECTOR_SIZE 0x1000
+
+/* the Flash commands are written to these two addresses */
+#define FLASH_COMMAND1 0x5555
+#define FLASH_COMMAND2 0x2aaa
+
+/* how long to poll for a byte to be programmed before giving up */
+#define FLASH_PROGRAM_TRIES 0x1000
+
+/* what save_step is doing */
+enum SaveState {
+    SAVE_IDLE,
+    SAVE_ERASING,
+    SAVE_WRITING
+};
+
+struct SaveRecord save_record;
+enum SaveType save_type = SAVE_NONE;
+
+/* the record being written out, and on SRAM a copy of what is in each slot
+ * so the bytes which have not changed can be skipped without reading it */
+static struct SaveImage save_pending EWRAM_BSS;
+static struct SaveImage save_images[SAVE_SRAM_SLOTS] EWRAM_BSS;
+
+/* the number of slots, the one with the newest record, the one being
+ * written and how far through it the write is */
+static int save_slots = 0;
+static int save_slot = 0;
+static int save_target = 0;
+static unsigned int save_position = 0;
+static unsigned int save_sequence = 0;
+static enum SaveState save_state = SAVE_IDLE;
+
+#ifdef HOST
+/* the number of bytes written and skipped, for the report */
+static unsigned int save_written = 0;
+static unsigned int save_skipped = 0;
+static unsigned int save_failed = 0;
+
+/* print what was saved when the program exits */
+static void save_report() {
+    fprintf(stderr, "save: record %u in slot %d, %u bytes written, %u unchanged, "
+            "%u failed\n", save_sequence, save_slot, save_written, save_skipped,
+            save_failed);
+}
+#endif
+
+/* a pointer to a byte of the backup memory */
+static volatile unsigned char* save_byte(unsigned int offset) {
+    return (volatile unsigned char*) MEM_SRAM(offset);
+}
+
+/* send a command to the Flash chip */
+static void flash_command(unsigned char command) {
+    *save_byte(FLASH_COMMAND1) = 0xaa;
+    *save_byte(FLASH_COMMAND2) = 0x55;
+    *save_byte(FLASH_COMMAND1) = command;
+}
+
+/* start erasing a sector, it takes tens of milliseconds and the sector reads
+ * back as all ones once it is done */
+static void flash_erase(unsigned int offset) {
+    flash_command(0x80);
+    *save_byte(FLASH_COMMAND1) = 0xaa;
+    *save_byte(FLASH_COMMAND2) = 0x55;
+    *save_byte(offset) = 0x30;
+}
+
+/* program one byte and wait for it to take, returns 0 if it never does */
+static int flash_program(unsigned int offset, unsigned char value) {
+    flash_command(0xa0);
+    *save_byte(offset) = value;
+    for (int i = 0; i < FLASH_PROGRAM_TRIES; i++) {
+        if (*save_byte(offset) == value) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* find out what kind of backup memory there is */
+static enum SaveType save_detect() {
+#ifdef HOST
+    /* the shim's save memory is SRAM, backed by the file named by GBA_SRAM */
+    return SAVE_SRAM;
+#else
+    /* SRAM takes a plain write, Flash ignores anything which is not a
+     * command, the last byte of the save area is never part of a record */
+    volatile unsigned char* probe = save_byte(SRAM_SAVE_OFFSET + SRAM_SAVE_SIZE - 1);
+    unsigned char old = *probe;
+    *probe = ~old;
+    if (*probe == (unsigned char) ~old) {
+        *probe = old;
+        return SAVE_SRAM;
+    }
+
+    /* ask the Flash chip who made it, the chip needs a moment before it
+     * answers */
+    flash_command(0x90);
+    for (volatile int i = 0; i < 2000; i++) { }
+    unsigned short id = *save_byte(0) | (*save_byte(1) << 8);
+    flash_command(0xf0);
+    for (volatile int i = 0; i < 2000; i++) { }
+
+    switch (id) {
+        case 0xd4bf:   /* SST */
+        case 0x1cc2:   /* Macronix 64K */
+        case 0x09c2:   /* Macronix 128K */
+        case 0x1b32:   /* Panasonic */
+        case 0x1362:   /* Sanyo 128K */
+            return SAVE_FLASH;
+        default:
+            /* no backup memory, or an Atmel chip which writes 128 byte pages
+             * rather than bytes */
+            return SAVE_NONE;
+    }
+#endif
+}
+
+/* the offset of a slot in the backup memory */
+static unsigned int save_slot_offset(int slot) {
+    if (save_type == SAVE_FLASH) {
+        return SAVE_FLASH_OFFSET + slot * SAVE_FLASH_SECTOR_SIZE;
+    }
+    return SRAM_SAVE_OFFSET + slot * SAVE_SRAM_SLOT_SIZE;
+}
+
+/* the checksum of a record, which takes in the sequence number too */
+static unsigned int save_checksum(const struct SaveImage* image) {
+    const unsigned int* words = (const unsigned int*) &image->record;
+    unsigned int sum = image->header.sequence;
+    for (unsigned int i = 0; i < sizeof(struct SaveRecord) / 4; i++) {
+        sum = ((sum << 5) | (sum >> 27)) + words[i];
+    }
+    return sum;
+}
+
+/* the record used when there is no good one saved */
+static void save_defaults() {
+    for (int i = 0; i < SAVE_SCORES; i++) {
+        save_record.scores[i].score = 0;
+        save_record.scores[i].name[0] = '-';
+        save_record.scores[i].name[1] = '-';
+        save_record.scores[i].name[2] = '-';
+        save_record.scores[i].name[3] = 0;
+    }
+
+    /* the volumes go from 0 to 16 and start at full */
+    save_record.settings.music_volume = 16;
+    save_record.settings.sound_volume = 16;
+    save_record.settings.flags = 0;
+    save_record.settings.reserved = 0;
+
+    save_record.replay.frames = 0;
+    save_record.replay.runs = 0;
+    save_record.replay.reserved = 0;
+}
+
+/* find the backup memory and load the newest good record from it */
+int save_init() {
+    int best = -1;
+
+    save_type = save_detect();
+    save_slots = save_type == SAVE_FLASH ? SAVE_FLASH_SLOTS : SAVE_SRAM_SLOTS;
+    save_state = SAVE_IDLE;
+    save_defaults();
+
+#ifdef HOST
+    atexit(save_report);
+#endif
+
+    if (save_type == SAVE_NONE) {
+        return 0;
+    }
+
+    for (int slot = 0; slot < save_slots; slot++) {
+        /* on SRAM each slot is read into its copy whether it is good or
+         * not, since that is what the next write is compared with */
+        struct SaveImage* image = save_type == SAVE_SRAM ? &save_images[slot] : &save_pending;
+        sram_read(save_slot_offset(slot), image, sizeof(struct SaveImage));
+
+        struct SaveHeader* header = &image->header;
+        if (header->magic != SAVE_MAGIC || header->version != SAVE_VERSION ||
+                header->size != sizeof(struct SaveRecord) ||
+                header->checksum != save_checksum(image)) {
+            continue;
+        }
+
+        /* the sequence number wraps around, so compare the difference */
+        if (best < 0 || (int) (header->sequence - save_sequence) > 0) {
+            best = slot;
+            save_sequence = header->sequence;
+            save_record = image->record;
+        }
+    }
+
+    /* with nothing saved the first write goes to slot 0 */
+    save_slot = best >= 0 ? best : save_slots - 1;
+    return best >= 0;
+}
+
+/* add a score to the table */
+int save_add_score(unsigned int score, const char* name) {
+    int place = 0;
+    while (place < SAVE_SCORES && save_record.scores[place].score >= score) {
+        place++;
+    }
+    if (place == SAVE_SCORES) {
+        return -1;
+    }
+
+    /* move the lower scores down one to make room */
+    for (int i = SAVE_SCORES - 1; i > place; i--) {
+        save_record.scores[i] = save_record.scores[i - 1];
+    }
+
+    save_record.scores[place].score = score;
+    for (int i = 0; i < 3; i++) {
+        save_record.scores[place].name[i] = name[i];
+        if (name[i] == 0) {
+            break;
+        }
+    }
+    save_record.scores[place].name[3] = 0;
+    return place;
+}
+
+/* add a frame to the end of a replay */
+void save_replay_add(struct SaveReplay* replay, unsigned short keys) {
+    if (replay->runs > 0) {
+        unsigned short* run = replay->run[replay->runs - 1];
+        if (run[0] == keys && run[1] < 0xffff) {
+            run[1]++;
+            replay->frames++;
+            return;
+        }
+    }
+
+    /* once the replay is full the rest of the run is not kept */
+    if (replay->runs >= SAVE_REPLAY_RUNS) {
+        return;
+    }
+    replay->run[replay->runs][0] = keys;
+    replay->run[replay->runs][1] = 1;
+    replay->runs++;
+    replay->frames++;
+}
+
+/* start writing out the record */
+void save_commit() {
+    if (save_type == SAVE_NONE) {
+        return;
+    }
+
+    save_pending.record = save_record;
+    save_pending.header.magic = SAVE_MAGIC;
+    save_pending.header.version = SAVE_VERSION;
+    save_pending.header.size = sizeof(struct SaveRecord);
+    save_pending.header.sequence = save_sequence + 1;
+    save_pending.header.checksum = save_checksum(&save_pending);
+
+    /* the newest record is left alone, if a write was already going this
+     * starts the same slot over */
+    save_target = save_slot + 1 == save_slots ? 0 : save_slot + 1;
+    save_position = 0;
+
+    if (save_type == SAVE_FLASH) {
+        flash_erase(save_slot_offset(save_target));
+        save_state = SAVE_ERASING;
+    } else {
+        save_state = SAVE_WRITING;
+    }
+}
+
+/* write up to the given number of changed bytes */
+int save_step(int bytes) {
+    unsigned int offset = save_slot_offset(save_target);
+    const unsigned int* words = (const unsigned int*) &save_pending;
+
+    if (save_state == SAVE_IDLE) {
+        return 0;
+    }
+
+    /* the erase goes on by itself, so this only checks whether it is done */
+    if (save_state == SAVE_ERASING) {
+        if (*save_byte(offset) != 0xff) {
+            return 1;
+        }
+        save_state = SAVE_WRITING;
+    }
+
+    while (save_position < SAVE_IMAGE_WORDS && bytes > 0) {
+        /* the body goes first and the header last */
+        unsigned int word = save_position + SAVE_HEADER_WORDS;
+        if (word >= SAVE_IMAGE_WORDS) {
+            word -= SAVE_IMAGE_WORDS;
+        }
+        save_position++;
+
+        /* the bytes already there are left alone, on SRAM that is what the
+         * slot held before and on Flash it is the all ones of the erase */
+        unsigned int value = words[word];
+        unsigned int old = 0xffffffff;
+        if (save_type == SAVE_SRAM) {
+            old = ((unsigned int*) &save_images[save_target])[word];
+            ((unsigned int*) &save_images[save_target])[word] = value;
+        }
+        if (value == old) {
+#ifdef HOST
+            save_skipped += 4;
+#endif
+            continue;
+        }
+
+        for (int i = 0; i < 4; i++) {
+            unsigned char byte = value >> (i * 8);
+            if (byte == (unsigned char) (old >> (i * 8))) {
+                continue;
+            }
+
+            if (save_type == SAVE_FLASH) {
+                if (!flash_program(offset + word * 4 + i, byte)) {
+                    /* the sector is worn out or the chip is gone, the last
+                     * good record is still there */
+#ifdef HOST
+                    save_failed++;
+#endif
+                    save_state = SAVE_IDLE;
+                    return 0;
+                }
+            } else {
+                *save_byte(offset + word * 4 + i) = byte;
+            }
+            bytes--;
+#ifdef HOST
+            save_written++;
+#endif
+        }
+    }
+
+    if (save_position < SAVE_IMAGE_WORDS) {
+        return 1;
+    }
+
+    /* the whole record is there now */
+    save_slot = save_target;
+    save_sequence = save_pending.header.sequence;
+    save_state = SAVE_IDLE;
+    return 0;
+}
+
+/* write the rest of the record now */
+void save_flush() {
+    while (save_step(sizeof(struct SaveImage))) { }
+}
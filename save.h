@@ -0,0 +1,87 @@
+/*
+ * save.h
+ * the save record, which keeps the high scores, the settings and the replay
+ * of the best run in the backup memory on the cartridge, whether that is
+ * SRAM or Flash
+ */
+
+#ifndef SAVE_H
+#define SAVE_H
+
+/* the kinds of backup memory a cartridge can have */
+enum SaveType {
+    SAVE_NONE,
+    SAVE_SRAM,
+    SAVE_FLASH
+};
+
+/* the number of high scores kept, and the most runs in the saved replay */
+#define SAVE_SCORES 8
+#define SAVE_REPLAY_RUNS 256
+
+/* the most bytes save_step writes in one call, a byte of Flash takes about
+ * 20 microseconds to program so this is a little over a millisecond */
+#define SAVE_STEP_BYTES 64
+
+/* a high score and the initials which go with it */
+struct SaveScore {
+    unsigned int score;
+    char name[4];
+};
+
+/* the settings the player can change */
+struct SaveSettings {
+    unsigned char music_volume;
+    unsigned char sound_volume;
+    unsigned char flags;
+    unsigned char reserved;
+};
+
+/* a replay, as runs of frames with the same buttons down like the ones the
+ * input module records */
+struct SaveReplay {
+    unsigned int frames;
+    unsigned short runs;
+    unsigned short reserved;
+    unsigned short run[SAVE_REPLAY_RUNS][2];
+};
+
+/* everything which is saved, the scores are kept best first */
+struct SaveRecord {
+    struct SaveScore scores[SAVE_SCORES];
+    struct SaveSettings settings;
+    struct SaveReplay replay;
+};
+
+/* the record the game reads and changes, it is only written out when
+ * save_commit is called */
+extern struct SaveRecord save_record;
+
+/* the kind of backup memory found by save_init */
+extern enum SaveType save_type;
+
+/* find the backup memory and load the newest good record from it, returns 0
+ * and fills in the defaults if there is none */
+int save_init();
+
+/* add a score to the table, returns its place or -1 if it is not good
+ * enough to go in */
+int save_add_score(unsigned int score, const char* name);
+
+/* add a frame with these buttons down to the end of a replay */
+void save_replay_add(struct SaveReplay* replay, unsigned short keys);
+
+/* start writing out the record as it is now, the writing is done a piece
+ * at a time by save_step so the game chooses when it happens */
+void save_commit();
+
+/* write up to the given number of changed bytes, returns 1 while there is
+ * still some of the record left to write, this should be called in frames
+ * where nothing is going on such as menus or between levels since Flash
+ * can stall for milliseconds */
+int save_step(int bytes);
+
+/* write the rest of the record now */
+void save_flush();
+
+#endif
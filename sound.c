@@ -0,0 +1,258 @@
+/*
+ * sound.c
+ * the Direct Sound mixer
+ *
+ * timer 0 overflows once a sample, which pulls a sample out of FIFO A, and
+ * whenever the FIFO is half empty DMA 1 refills it with 4 more words from
+ * the buffer playing, at 18157 samples a second a frame is exactly 304
+ * samples so the DMA is restarted on the next buffer each vblank
+ */
+
+#include "gba.h"
+#include "profile.h"
+#include "sound.h"
+
+#ifdef HOST
+#include <stdio.h>
+#include <stdlib.h>
+#include "host.h"
+#endif
+
+/* the voices */
+struct SoundVoice sound_voices[SOUND_VOICES];
+
+/* the two buffers, each has an extra 4 words since the DMA may ask for a
+ * little more before vblank restarts it */
+static signed char sound_buffers[2][SOUND_FRAME_SAMPLES + 16] __attribute__((aligned(4)));
+static int sound_back = 0;
+
+/* the trigger queue, the producer only writes the head and the consumer
+ * only writes the tail, so neither has to lock the other out, an entry is
+ * filled in before the head moves past it */
+struct SoundTrigger {
+    const struct SoundEffect* effect;
+    unsigned short rate;
+};
+static struct SoundTrigger sound_queue[SOUND_QUEUE_SIZE];
+static volatile unsigned char sound_head = 0;
+static volatile unsigned char sound_tail = 0;
+
+/* stops the compiler moving memory accesses across it, the CPU does them in
+ * order anyway */
+#define SOUND_BARRIER() __asm__ volatile ("" ::: "memory")
+
+#ifdef HOST
+/* the triggers taken, the voices stolen and the triggers which got neither
+ * a place in the queue nor a voice, for the report */
+static unsigned int sound_triggers = 0;
+static unsigned int sound_stolen = 0;
+static unsigned int sound_dropped = 0;
+
+/* print the trigger counts when the program exits */
+static void sound_report() {
+    fprintf(stderr, "sound: %u triggers, %u voices stolen, %u dropped\n",
+            sound_triggers, sound_stolen, sound_dropped);
+}
+#endif
+
+/* turn on Direct Sound A and start timer 0 */
+void sound_init() {
+    for (int i = 0; i < SOUND_VOICES; i++) {
+        sound_voices[i].active = 0;
+    }
+    for (int i = 0; i < SOUND_FRAME_SAMPLES + 16; i++) {
+        sound_buffers[0][i] = 0;
+        sound_buffers[1][i] = 0;
+    }
+
+    /* FIFO A at full volume to both speakers, on timer 0 */
+    *sound_master = SOUND_ENABLE;
+    *sound_control = 0;
+    *sound_direct = SOUND_A_FULL | SOUND_A_RIGHT | SOUND_A_LEFT | SOUND_A_RESET;
+
+    *timer0_control = 0;
+    *timer0_data = 65536 - SOUND_TIMER_CYCLES;
+    *timer0_control = TIMER_ENABLE | TIMER_FREQ_1;
+
+#ifdef HOST
+    atexit(sound_report);
+#endif
+}
+
+/* start a sample on a voice */
+static void sound_start(struct SoundVoice* voice, const signed char* data, int length,
+        int rate, int volume, int loop, int priority) {
+    voice->data = data;
+    voice->position = 0;
+    voice->step = (rate << 12) / SOUND_RATE;
+    if (voice->step == 0) {
+        voice->step = 1;
+    }
+    voice->end = length << 12;
+    voice->loop = loop < 0 ? 0 : loop << 12;
+    voice->looping = loop >= 0;
+    voice->volume = volume > SOUND_MAX_VOLUME ? SOUND_MAX_VOLUME : volume;
+    voice->priority = priority;
+    voice->active = 1;
+}
+
+/* play a sample on a free voice */
+int sound_play(const signed char* data, int length, int rate, int volume, int loop) {
+    for (int i = 0; i < SOUND_VOICES; i++) {
+        if (!sound_voices[i].active) {
+            sound_start(&sound_voices[i], data, length, rate, volume, loop, 0);
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* ask for a sound effect to be started */
+int sound_trigger(const struct SoundEffect* effect, int rate) {
+    unsigned char head = sound_head;
+    unsigned char next = (head + 1) & (SOUND_QUEUE_SIZE - 1);
+    if (next == sound_tail) {
+#ifdef HOST
+        sound_dropped++;
+#endif
+        return 0;
+    }
+
+    sound_queue[head].effect = effect;
+    sound_queue[head].rate = rate != 0 ? rate : effect->rate;
+    SOUND_BARRIER();
+    sound_head = next;
+    return 1;
+}
+
+/* start the effects which have been triggered, on a free voice if there is
+ * one, or else on the lowest priority voice if it is no higher than the
+ * effect, picking the one which has played the most of its sample */
+static void sound_start_triggers() {
+    unsigned char tail = sound_tail;
+    unsigned char head = sound_head;
+    SOUND_BARRIER();
+
+    while (tail != head) {
+        const struct SoundEffect* effect = sound_queue[tail].effect;
+        int rate = sound_queue[tail].rate;
+        tail = (tail + 1) & (SOUND_QUEUE_SIZE - 1);
+
+        struct SoundVoice* best = 0;
+        for (int i = 0; i < SOUND_VOICES; i++) {
+            struct SoundVoice* voice = &sound_voices[i];
+            if (!voice->active) {
+                best = voice;
+                break;
+            }
+            if (voice->priority > effect->priority) {
+                continue;
+            }
+            if (best == 0 || voice->priority < best->priority ||
+                    (voice->priority == best->priority && voice->position > best->position)) {
+                best = voice;
+            }
+        }
+
+#ifdef HOST
+        sound_triggers++;
+        if (best == 0) {
+            sound_dropped++;
+        } else if (best->active) {
+            sound_stolen++;
+        }
+#endif
+        if (best != 0) {
+            sound_start(best, effect->data, effect->length, rate, effect->volume, -1,
+                    effect->priority);
+        }
+    }
+
+    SOUND_BARRIER();
+    sound_tail = tail;
+}
+
+/* stop a voice */
+void sound_stop(int voice) {
+    sound_voices[voice].active = 0;
+}
+
+/* mix the next frame of sound */
+IWRAM_ARM_CODE void sound_mix() {
+    static int mix[SOUND_FRAME_SAMPLES];
+
+    profile_begin(PROFILE_SOUND);
+    sound_start_triggers();
+    for (int i = 0; i < SOUND_FRAME_SAMPLES; i++) {
+        mix[i] = 0;
+    }
+
+    for (int v = 0; v < SOUND_VOICES; v++) {
+        struct SoundVoice* voice = &sound_voices[v];
+        if (!voice->active) {
+            continue;
+        }
+
+        const signed char* data = voice->data;
+        unsigned int position = voice->position;
+        unsigned int step = voice->step;
+        int volume = voice->volume;
+        int i = 0;
+
+        while (i < SOUND_FRAME_SAMPLES) {
+            /* work out how many samples there are before the end, once per
+             * stretch rather than testing every sample */
+            int count = (voice->end - position + step - 1) / step;
+            if (count > SOUND_FRAME_SAMPLES - i) {
+                count = SOUND_FRAME_SAMPLES - i;
+            }
+            for (int end = i + count; i < end; i++) {
+                mix[i] += data[position >> 12] * volume;
+                position += step;
+            }
+
+            if (position >= voice->end) {
+                if (!voice->looping) {
+                    voice->active = 0;
+                    break;
+                }
+                position = voice->loop + (position - voice->end);
+            }
+        }
+        voice->position = position;
+    }
+
+    /* scale back down to 8 bits, clip, and pack four samples into each
+     * word so the buffer is written a word at a time */
+    unsigned int* out = (unsigned int*) sound_buffers[sound_back];
+    for (int i = 0; i < SOUND_FRAME_SAMPLES; i += 4) {
+        unsigned int packed = 0;
+        for (int j = 0; j < 4; j++) {
+            int sample = mix[i + j] >> 6;
+            if (sample > 127) {
+                sample = 127;
+            } else if (sample < -128) {
+                sample = -128;
+            }
+            packed |= (sample & 0xff) << (j * 8);
+        }
+        *out++ = packed;
+    }
+    profile_end(PROFILE_SOUND);
+}
+
+/* the vblank task which starts the buffer just mixed playing */
+void sound_task(void* data) {
+    signed char* buffer = sound_buffers[sound_back];
+    sound_back ^= 1;
+
+#ifdef HOST
+    /* the shim keeps what would have played */
+    host_audio(buffer, SOUND_FRAME_SAMPLES, SOUND_RATE);
+#else
+    *dma1_count = 0;
+    *dma1_source = (unsigned int) buffer;
+    *dma1_destination = (unsigned int) sound_fifo_a;
+    *dma1_count = DMA_DEST_FIXED | DMA_REPEAT | DMA_32 | DMA_AT_FIFO | DMA_ENABLE;
+#endif
+}
@@ -0,0 +1,87 @@
+/*
+ * sound.h
+ * a software mixer for Direct Sound, a number of 8-bit PCM voices are mixed
+ * once a frame into one of two buffers, and DMA 1 feeds the other one to
+ * FIFO A on timer 0, the buffers swap in vblank
+ */
+
+#ifndef SOUND_H
+#define SOUND_H
+
+#include "gba.h"
+
+/* the mixing rate, which is picked so a frame is a whole number of samples,
+ * the timer ticks once a sample */
+#define SOUND_RATE 18157
+#define SOUND_FRAME_SAMPLES 304
+#define SOUND_TIMER_CYCLES 924
+
+/* the number of voices mixed */
+#define SOUND_VOICES 8
+
+/* the loudest a voice can be */
+#define SOUND_MAX_VOLUME 64
+
+/* a voice playing a sample, the position and step are 20.12 fixed point */
+struct SoundVoice {
+    const signed char* data;
+    unsigned int position;
+    unsigned int step;
+    unsigned int end;
+
+    /* where the sample goes back to when it reaches the end, if it loops */
+    unsigned int loop;
+    unsigned char looping;
+
+    unsigned char volume;
+    unsigned char active;
+
+    /* how much the voice matters when one has to be taken for a new sound */
+    unsigned char priority;
+};
+
+extern struct SoundVoice sound_voices[SOUND_VOICES];
+
+/* a sound effect, a sample and how to play it, higher priority effects can
+ * take the voice of a lower or equal one when they are all busy */
+struct SoundEffect {
+    const signed char* data;
+    unsigned short length;
+    unsigned short rate;
+    unsigned char volume;
+    unsigned char priority;
+};
+
+/* the number of triggers which can be waiting, a power of two */
+#define SOUND_QUEUE_SIZE 16
+
+/* turn on Direct Sound A and start timer 0 and the two buffers */
+void sound_init();
+
+/* play a sample of length bytes on a free voice at rate samples per second,
+ * loop is the offset it loops back to or -1 to play once, returns the
+ * voice or -1 if they are all busy */
+int sound_play(const signed char* data, int length, int rate, int volume, int loop);
+
+/* ask for a sound effect to be started at rate samples a second, or at its
+ * own rate if rate is 0, the next time the mixer runs, this takes the same
+ * short time whatever the mixer is doing and returns 0 if the queue is
+ * full
+ *
+ * the queue has one producer and one consumer, the mixer, so triggers must
+ * come from the game loop or from one interrupt handler but not both */
+int sound_trigger(const struct SoundEffect* effect, int rate);
+
+/* stop a voice */
+void sound_stop(int voice);
+
+/* mix the next frame of sound into the buffer which is not playing, this
+ * is called once a frame, and is ARM code in IWRAM whatever the build since
+ * from ROM as Thumb code it would take up to a quarter of the frame */
+IWRAM_ARM_CODE void sound_mix();
+
+/* the vblank task which starts the buffer just mixed playing, this has to
+ * run every vblank so the sound does not drift */
+void sound_task(void* data);
+
+#endif
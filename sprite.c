@@ -0,0 +1,302 @@
+/*
+ * sprite.c
+ * the sprites and the functions for setting them up and moving them around
+ */
+
+#include "gba.h"
+#include "profile.h"
+#include "sprite.h"
+
+/* array of all the sprites available on the GBA, word aligned so they can
+ * be copied a word at a time */
+struct Sprite sprites[NUM_SPRITES] __attribute__((aligned(4)));
+int next_sprite_index = 0;
+
+/* set when any sprite has changed since they were last copied to OAM */
+int sprite_dirty = 0;
+
+/* whether the sprites are sorted on the way into OAM, and the order they
+ * went in last time, which the next sort starts from */
+static int sprite_sorting = 0;
+static unsigned char sprite_order[NUM_SPRITES];
+
+/* the entries which are sorted, the ones after them stay where they are */
+static int sprite_sorted = NUM_SPRITES;
+
+/* the most entries the insertion sort may shift before it gives up and
+ * falls back on the radix sort, a frame where things only moved a little
+ * takes a handful */
+#define SORT_MAX_SHIFTS (NUM_SPRITES * 4)
+
+/* the width and height in pixels of each sprite shape and size */
+const unsigned char sprite_widths[3][4] = {
+    {8, 16, 32, 64},
+    {16, 32, 32, 64},
+    {8, 8, 16, 32}
+};
+const unsigned char sprite_heights[3][4] = {
+    {8, 16, 32, 64},
+    {8, 8, 16, 32},
+    {16, 32, 32, 64}
+};
+
+/* function to initialize a sprite with its properties, and return a pointer */
+struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
+        int horizontal_flip, int vertical_flip, int tile_index, int priority) {
+
+    /* grab the next index */
+    int index = next_sprite_index++;
+
+    /* setup the bits used for each shape/size possible */
+    int size_bits, shape_bits;
+    switch (size) {
+        case SIZE_8_8:   size_bits = 0; shape_bits = 0; break;
+        case SIZE_16_16: size_bits = 1; shape_bits = 0; break;
+        case SIZE_32_32: size_bits = 2; shape_bits = 0; break;
+        case SIZE_64_64: size_bits = 3; shape_bits = 0; break;
+        case SIZE_16_8:  size_bits = 0; shape_bits = 1; break;
+        case SIZE_32_8:  size_bits = 1; shape_bits = 1; break;
+        case SIZE_32_16: size_bits = 2; shape_bits = 1; break;
+        case SIZE_64_32: size_bits = 3; shape_bits = 1; break;
+        case SIZE_8_16:  size_bits = 0; shape_bits = 2; break;
+        case SIZE_8_32:  size_bits = 1; shape_bits = 2; break;
+        case SIZE_16_32: size_bits = 2; shape_bits = 2; break;
+        case SIZE_32_64: size_bits = 3; shape_bits = 2; break;
+        default:         size_bits = 0; shape_bits = 0; break;
+    }
+
+    int h = horizontal_flip ? 1 : 0;
+    int v = vertical_flip ? 1 : 0;
+
+    /* set up the first attribute */
+    sprites[index].attribute0 = y |             /* y coordinate */
+                            (0 << 8) |          /* rendering mode */
+                            (0 << 10) |         /* gfx mode */
+                            (0 << 12) |         /* mosaic */
+                            (1 << 13) |         /* color mode, 0:16, 1:256 */
+                            (shape_bits << 14); /* shape */
+
+    /* set up the second attribute */
+    sprites[index].attribute1 = x |             /* x coordinate */
+                            (0 << 9) |          /* affine flag */
+                            (h << 12) |         /* horizontal flip flag */
+                            (v << 13) |         /* vertical flip flag */
+                            (size_bits << 14);  /* size */
+
+    /* setup the second attribute */
+    sprites[index].attribute2 = tile_index |   // tile index */
+                            (priority << 10) | // priority */
+                            (0 << 12);         // palette bank (only 16 color)*/
+
+    /* return pointer to this sprite */
+    sprite_dirty = 1;
+    return &sprites[index];
+}
+
+/* take a run of sprites */
+struct Sprite* sprite_reserve(int count) {
+    if (next_sprite_index + count > NUM_SPRITES) {
+        return 0;
+    }
+
+    struct Sprite* first = &sprites[next_sprite_index];
+    next_sprite_index += count;
+    return first;
+}
+
+/* turn sorting on or off */
+void sprite_sort_enable(int enable) {
+    sprite_sorting = enable;
+    for (int i = 0; i < NUM_SPRITES; i++) {
+        sprite_order[i] = i;
+    }
+    sprite_dirty = 1;
+}
+
+/* leave the entries from first up out of the sort */
+void sprite_sort_keep(int first) {
+    sprite_sorted = first;
+    sprite_sort_enable(sprite_sorting);
+}
+
+/* the key a sprite is sorted on, the priority in the high byte and the
+ * distance up from the bottom of the screen in the low one, a y past the
+ * bottom counts as above the top like the hardware does, and the hidden
+ * sprites end up last */
+static inline unsigned short sprite_key(const struct Sprite* sprite) {
+    int priority = (sprite->attribute2 >> 10) & 3;
+    int depth = ((sprite->attribute0 & 0xff) + 96) & 0xff;
+    return (priority << 8) | (255 - depth);
+}
+
+/* sort the order by two passes of a counting sort, a byte of the key each */
+static void sprite_radix_sort(const unsigned short* keys) {
+    static unsigned char temp[NUM_SPRITES];
+    unsigned short counts[256];
+
+    for (int shift = 0; shift < 16; shift += 8) {
+        unsigned char* from = shift == 0 ? sprite_order : temp;
+        unsigned char* to = shift == 0 ? temp : sprite_order;
+
+        for (int i = 0; i < 256; i++) {
+            counts[i] = 0;
+        }
+        for (int i = 0; i < sprite_sorted; i++) {
+            counts[(keys[from[i]] >> shift) & 0xff]++;
+        }
+
+        /* the counts become the start of each bucket */
+        int total = 0;
+        for (int i = 0; i < 256; i++) {
+            int count = counts[i];
+            counts[i] = total;
+            total += count;
+        }
+        for (int i = 0; i < sprite_sorted; i++) {
+            to[counts[(keys[from[i]] >> shift) & 0xff]++] = from[i];
+        }
+    }
+}
+
+/* sort the order starting from last frame's, which is nearly right already
+ * since sprites only move a few lines at a time */
+IWRAM_CODE static void sprite_sort() {
+    static unsigned short keys[NUM_SPRITES];
+    for (int i = 0; i < sprite_sorted; i++) {
+        keys[i] = sprite_key(&sprites[i]);
+    }
+
+    int shifts = 0;
+    for (int i = 1; i < sprite_sorted; i++) {
+        int index = sprite_order[i];
+        unsigned short key = keys[index];
+        int j = i;
+        while (j > 0 && keys[sprite_order[j - 1]] > key) {
+            sprite_order[j] = sprite_order[j - 1];
+            j--;
+        }
+        sprite_order[j] = index;
+
+        /* too much has changed, so sort the rest in linear time */
+        shifts += i - j;
+        if (shifts > SORT_MAX_SHIFTS) {
+            sprite_radix_sort(keys);
+            return;
+        }
+    }
+}
+
+/* update all of the sprites on the screen, if any have changed */
+void sprite_update_all() {
+    if (!sprite_dirty) {
+        return;
+    }
+
+    if (sprite_sorting) {
+        /* copy them over one at a time in the sorted order, a word at a
+         * time since OAM has a 32-bit bus */
+        sprite_sort();
+        volatile unsigned int* oam = (volatile unsigned int*) sprite_attribute_memory;
+        for (int i = 0; i < NUM_SPRITES; i++) {
+            const unsigned int* sprite = (const unsigned int*) &sprites[sprite_order[i]];
+            oam[i * 2] = sprite[0];
+            oam[i * 2 + 1] = sprite[1];
+        }
+    } else {
+        /* copy them all over */
+        memcpy16_dma((unsigned short*) sprite_attribute_memory, (unsigned short*) sprites, NUM_SPRITES * 4);
+    }
+    sprite_dirty = 0;
+}
+
+/* the vblank task which copies the sprites into OAM */
+void sprite_update_task(void* data) {
+    profile_begin(PROFILE_OAM);
+    sprite_update_all();
+    profile_end(PROFILE_OAM);
+}
+
+/* setup all sprites */
+void sprite_clear() {
+    /* clear the index counter */
+    next_sprite_index = 0;
+
+    /* move all sprites offscreen to hide them */
+    for(int i = 0; i < NUM_SPRITES; i++) {
+        sprites[i].attribute0 = SCREEN_HEIGHT;
+        sprites[i].attribute1 = SCREEN_WIDTH;
+    }
+    sprite_dirty = 1;
+}
+
+/* set a sprite postion */
+IWRAM_CODE void sprite_position(struct Sprite* sprite, int x, int y) {
+    /* swap in the new y and x coordinates */
+    unsigned short attribute0 = (sprite->attribute0 & 0xff00) | (y & 0xff);
+    unsigned short attribute1 = (sprite->attribute1 & 0xfe00) | (x & 0x1ff);
+
+    /* only mark the sprites dirty if it actually moved */
+    if (attribute0 != sprite->attribute0 || attribute1 != sprite->attribute1) {
+        sprite->attribute0 = attribute0;
+        sprite->attribute1 = attribute1;
+        sprite_dirty = 1;
+    }
+}
+
+/* move a sprite in a direction */
+void sprite_move(struct Sprite* sprite, int dx, int dy) {
+    /* get the current y coordinate */
+    int y = sprite->attribute0 & 0xff;
+
+    /* get the current x coordinate */
+    int x = sprite->attribute1 & 0x1ff;
+
+    /* move to the new location */
+    sprite_position(sprite, x + dx, y + dy);
+}
+
+/* change the vertical flip flag */
+void sprite_set_vertical_flip(struct Sprite* sprite, int vertical_flip) {
+    unsigned short attribute1 = sprite->attribute1;
+    if (vertical_flip) {
+        /* set the bit */
+        attribute1 |= 0x2000;
+    } else {
+        /* clear the bit */
+        attribute1 &= 0xdfff;
+    }
+
+    /* only mark the sprites dirty if the flip changed */
+    if (attribute1 != sprite->attribute1) {
+        sprite->attribute1 = attribute1;
+        sprite_dirty = 1;
+    }
+}
+
+/* change the horizontal flip flag */
+void sprite_set_horizontal_flip(struct Sprite* sprite, int horizontal_flip) {
+    unsigned short attribute1 = sprite->attribute1;
+    if (horizontal_flip) {
+        /* set the bit */
+        attribute1 |= 0x1000;
+    } else {
+        /* clear the bit */
+        attribute1 &= 0xefff;
+    }
+
+    /* only mark the sprites dirty if the flip changed */
+    if (attribute1 != sprite->attribute1) {
+        sprite->attribute1 = attribute1;
+        sprite_dirty = 1;
+    }
+}
+
+/* change the tile offset of a sprite */
+void sprite_set_offset(struct Sprite* sprite, int offset) {
+    /* clear the old offset */
+    sprite->attribute2 &= 0xfc00;
+
+    /* apply the new one */
+    sprite->attribute2 |= (offset & 0x03ff);
+    sprite_dirty = 1;
+}
@@ -0,0 +1,96 @@
+/*
+ * sprite.h
+ * the sprites, which are kept in a copy of OAM in RAM and copied over to
+ * the real thing during vblank
+ */
+
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include "gba.h"
+
+/* there are 128 sprites on the GBA */
+#define NUM_SPRITES 128
+
+/* the words in OAM, which is what copying the sprites over costs in the
+ * vblank queue */
+#define SPRITE_OAM_WORDS (NUM_SPRITES * 2)
+
+/* a sprite is a moveable image on the screen */
+struct Sprite {
+    unsigned short attribute0;
+    unsigned short attribute1;
+    unsigned short attribute2;
+    unsigned short attribute3;
+};
+
+/* array of all the sprites available on the GBA */
+extern struct Sprite sprites[NUM_SPRITES];
+extern int next_sprite_index;
+
+/* set when any sprite has changed since they were last copied to OAM */
+extern int sprite_dirty;
+
+/* the different sizes of sprites which are possible */
+enum SpriteSize {
+    SIZE_8_8,
+    SIZE_16_16,
+    SIZE_32_32,
+    SIZE_64_64,
+    SIZE_16_8,
+    SIZE_32_8,
+    SIZE_32_16,
+    SIZE_64_32,
+    SIZE_8_16,
+    SIZE_8_32,
+    SIZE_16_32,
+    SIZE_32_64
+};
+
+/* the width and height in pixels of each sprite shape (the top two bits of
+ * attribute 0) and size (the top two bits of attribute 1) */
+extern const unsigned char sprite_widths[3][4];
+extern const unsigned char sprite_heights[3][4];
+
+/* function to initialize a sprite with its properties, and return a pointer */
+struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
+        int horizontal_flip, int vertical_flip, int tile_index, int priority);
+
+/* take a run of count sprites to fill in directly, such as for a
+ * metasprite, returns 0 if there are not that many left */
+struct Sprite* sprite_reserve(int count);
+
+/* when sorting is on, the sprites are copied into OAM in order of their
+ * priority and then from the bottom of the screen up, so the ones in front
+ * get the lower OAM entries which the hardware draws on top, sprite_init
+ * still hands out the entries in sprites in creation order */
+void sprite_sort_enable(int enable);
+
+/* leave the entries from first up out of the sort, so they go into OAM in
+ * the same place they are in sprites, which the multiplexer needs since it
+ * rewrites its entries in OAM itself */
+void sprite_sort_keep(int first);
+
+/* update all of the sprites on the screen, if any have changed */
+void sprite_update_all();
+
+/* the vblank task which copies the sprites into OAM */
+void sprite_update_task(void* data);
+
+/* setup all sprites */
+void sprite_clear();
+
+/* set a sprite position */
+IWRAM_CODE void sprite_position(struct Sprite* sprite, int x, int y);
+
+/* move a sprite in a direction */
+void sprite_move(struct Sprite* sprite, int dx, int dy);
+
+/* change the flip flags */
+void sprite_set_vertical_flip(struct Sprite* sprite, int vertical_flip);
+void sprite_set_horizontal_flip(struct Sprite* sprite, int horizontal_flip);
+
+/* change the tile offset of a sprite */
+void sprite_set_offset(struct Sprite* sprite, int offset);
+
+#endif
@@ -4,156 +4,82 @@
  * simple catcher game for the GBA
  */
 
-#define SCREEN_WIDTH 240
-#define SCREEN_HEIGHT 160
-
 /* include these files */
+#include "gba.h"
+#include "input.h"
+#include "profile.h"
+#include "vblank.h"
+#include "sprite.h"
+#include "metasprite.h"
+#include "metasprites.h"
+#include "anim.h"
+#include "anims.h"
+#include "tileanim.h"
+#include "layer.h"
+#include "palette.h"
+#include "music.h"
+#include "theme.h"
 #include "bowl2.h"
 #include "map.h"
 #include "bg.h"
 
-/* the tile mode flags needed for display control register */
-#define MODE0 0x00
-#define MODE1 0x00
-#define MODE4 0x0400
-#define BG0_ENABLE 0x100
-#define BG1_ENABLE 0x200
-
-//control registers for tile layers
-volatile unsigned short* bg0_control = (volatile unsigned short*) 0x4000008;
-volatile unsigned short* bg1_control = (volatile     unsigned short*) 0x400000a;
-
-/* flags to set sprite handling in display control register */
-#define SPRITE_MAP_2D 0x0
-#define SPRITE_MAP_1D 0x40
-#define SPRITE_ENABLE 0x1000
-
-/* palette is always 256 colors */
-#define PALETTE_SIZE 256
-
-/* there are 128 sprites on the GBA */
-#define NUM_SPRITES 128
-
-/* the display control pointer points to the gba graphics register */
-volatile unsigned long* display_control = (volatile unsigned long*) 0x4000000;
-#define SHOW_BACK
-
-/*  pointer points to 16-bit colors of which there are 240x160 */
- volatile unsigned short* screen = (volatile unsigned short*) 0x6000000;
-volatile unsigned short* front_buffer = (volatile unsigned short*) 0x6000000;
-volatile unsigned short* back_buffer = (volatile unsigned short*)  0x600A000;
-
-/* the memory location which controls sprite attributes */
-volatile unsigned short* sprite_attribute_memory = (volatile unsigned short*) 0x7000000;
-
-/* the memory location which stores sprite image data */
-volatile unsigned short* sprite_image_memory = (volatile unsigned short*) 0x6010000;
-
-/* the address of the color palettes used for backgrounds and sprites */
-volatile unsigned short* background_palette = (volatile unsigned short*) 0x5000000;
-volatile unsigned short* sprite_palette = (volatile unsigned short*) 0x5000200;
 int next_palette_index = 0;
 
-/* the button register holds the bits which indicate whether each button has
- * been pressed - this has got to be volatile as well
- */
-volatile unsigned short* buttons = (volatile unsigned short*) 0x04000130;
-unsigned char button_pressed(unsigned short button) {     /* and the button register with the button constant we want */
-     unsigned short pressed = *buttons & button;
-    /* if this value is zero, then it's not pressed */
-     if (pressed == 0) {
-         return 1;
-     } else {
-         return 0;
-     }
-}
-
-/* scrolling registers for backgrounds */
-volatile short* bg0_x_scroll = (unsigned short*) 0x4000010;
-volatile short* bg0_y_scroll = (unsigned short*) 0x4000012;
-volatile short* bg1_x_scroll = (unsigned short*) 0x4000014;
-volatile short* bg1_y_scroll = (unsigned short*) 0x4000016;
-/* the bit positions indicate each button - the first bit is for A, second for
- * B, and so on, each constant below can be ANDED into the register to get the
- * status of any one button */
-#define BUTTON_A (1 << 0)
-#define BUTTON_B (1 << 1)
-#define BUTTON_SELECT (1 << 2)
-#define BUTTON_START (1 << 3)
-#define BUTTON_RIGHT (1 << 4)
-#define BUTTON_LEFT (1 << 5)
-#define BUTTON_UP (1 << 6)
-#define BUTTON_DOWN (1 << 7)
-#define BUTTON_R (1 << 8)
-#define BUTTON_L (1 << 9)
-
-/* the scanline counter is a memory cell which is updated to indicate how
- * much of the screen has been drawn */
-volatile unsigned short* scanline_counter = (volatile unsigned short*) 0x4000006;
-
-/* wait for the screen to be fully drawn so we can do something during vblank */
-void wait_vblank() {
-    /* wait until all 160 lines have been updated */
-    while (*scanline_counter < 160) { }
-}
-
-/* return a pointer to one of the 4 character blocks (0-3) */
-volatile unsigned short* char_block(unsigned long block) {
-    /* they are each 16K big */
-    return (volatile unsigned short*) (0x6000000 + (block * 0x4000));
-}
-
-/* return a pointer to one of the 32 screen blocks (0-31) */
-volatile unsigned short* screen_block(unsigned long block) {
-    /* they are each 2K big */
-    return (volatile unsigned short*) (0x6000000 + (block * 0x800));
-}
-
-/* flag for turning on DMA */
-#define DMA_ENABLE 0x80000000
-
-/* flags for the sizes to transfer, 16 or 32 bits */
-#define DMA_16 0x00000000
-#define DMA_32 0x04000000
-
-/* pointer to the DMA source location */
-volatile unsigned int* dma_source = (volatile unsigned int*) 0x40000D4;
+/* the background is the map followed by a mirror image of it, so it is
+ * 512 pixels wide and joins up at both ends as it scrolls */
+#define WIDE_MAP_WIDTH (map_width * 2)
+unsigned short wide_map[WIDE_MAP_WIDTH * map_height];
 
-/* pointer to the DMA destination location */
-volatile unsigned int* dma_destination = (volatile unsigned int*) 0x40000D8;
-
-/* pointer to the DMA count/control */
-volatile unsigned int* dma_count = (volatile unsigned int*) 0x40000DC;
+/* the background, on bg0 with its tiles in char block 0 and its map in
+ * screen blocks 16 and 17 */
+const struct Tileset bg_tileset = {
+    bg_data, bg_width * bg_height, bg_palette, 256
+};
+const struct Layer background = {
+    0,                      /* the layer */
+    &bg_tileset, wide_map, WIDE_MAP_WIDTH, map_height,
+    0,                      /* palette bank */
+    0, 16,                  /* char and screen block */
+    0,                      /* priority */
+    LAYER_512_256
+};
 
-/* copy data using DMA */
-void memcpy16_dma(unsigned short* dest, unsigned short* source, int amount) {
-    *dma_source = (unsigned int) source;
-    *dma_destination = (unsigned int) dest;
-    *dma_count = amount | DMA_16 | DMA_ENABLE;
+/* make the wide map, the mirrored half has the horizontal flip bit set on
+ * each of its tiles */
+void setup_wide_map() {
+    for (int y = 0; y < map_height; y++) {
+        for (int x = 0; x < map_width; x++) {
+            wide_map[y * WIDE_MAP_WIDTH + x] = map[y * map_width + x];
+            wide_map[y * WIDE_MAP_WIDTH + WIDE_MAP_WIDTH - 1 - x] =
+                map[y * map_width + x] ^ 0x400;
+        }
+    }
 }
 
-/* function to setup background 0 for this program */
-void setup_background() {
-
-    /* load the palette from the image into palette memory*/
-    memcpy16_dma((unsigned short*) background_palette, (unsigned short*) 
-bg_palette, PALETTE_SIZE);
-
-    /* load the image into char block 0 */
-    memcpy16_dma((unsigned short*) char_block(0), (unsigned short*) bg_data,
-            (bg_width * bg_height) / 2);
-
-    /* set all control the bits in this register */
-    *bg0_control = 0 |    /* priority, 0 is highest, 3 is lowest */
-        (0 << 2)  |       /* the char block the image data is stored in */
-        (0 << 6)  |       /* the mosaic flag */
-        (1 << 7)  |       /* color mode, 0 is 16 colors, 1 is 256 colors */
-        (16 << 8) |       /* the screen block the tile data is stored in */
-        (1 << 13) |       /* wrapping flag */
-        (0 << 14);        /* bg size, 0 is 256x256 */
-
-    /* load the tile data into screen block 16 */
-    memcpy16_dma((unsigned short*) screen_block(16), (unsigned short*) map, map_width * map_height);
+/* the water tile in the background, and the palette entries of the water
+ * and of the lighter color which ripples across it */
+#define WATER_TILE 0x198
+#define WATER_COLOR 4
+#define RIPPLE_COLOR 5
+#define WATER_FRAMES 4
+
+/* the frames of the water, made when the demo starts */
+unsigned short water_frames[WATER_FRAMES][32];
+
+/* make the water frames, a few short ripples which drift right and wrap
+ * around so the tiles join up */
+void setup_water(struct TileAnim* water) {
+    for (int frame = 0; frame < WATER_FRAMES; frame++) {
+        unsigned char* pixels = (unsigned char*) water_frames[frame];
+        for (int i = 0; i < 64; i++) {
+            pixels[i] = WATER_COLOR;
+        }
+        for (int x = 0; x < 3; x++) {
+            pixels[1 * 8 + ((frame * 2 + x) & 7)] = RIPPLE_COLOR;
+            pixels[5 * 8 + ((frame * 2 + x + 4) & 7)] = RIPPLE_COLOR;
+        }
+    }
+    tile_anim_init(water, 0, WATER_TILE, 1, 256, water_frames, WATER_FRAMES, 12);
 }
 
 /* just kill time */
@@ -177,161 +103,6 @@ void delay(unsigned int amount) {
 }
 
 
-/* a sprite is a moveable image on the screen */
-struct Sprite {
-    unsigned short attribute0;
-    unsigned short attribute1;
-    unsigned short attribute2;
-    unsigned short attribute3;
-};
-
-/* array of all the sprites available on the GBA */
-struct Sprite sprites[NUM_SPRITES];
-int next_sprite_index = 0;
-
-/* the different sizes of sprites which are possible */
-enum SpriteSize {
-    SIZE_8_8,
-    SIZE_16_16,
-    SIZE_32_32,
-    SIZE_64_64,
-    SIZE_16_8,
-    SIZE_32_8,
-    SIZE_32_16,
-    SIZE_64_32,
-    SIZE_8_16,
-    SIZE_8_32,
-    SIZE_16_32,
-    SIZE_32_64
-};
-
-/* function to initialize a sprite with its properties, and return a pointer */
-struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
-        int horizontal_flip, int vertical_flip, int tile_index, int priority) {
-
-    /* grab the next index */
-    int index = next_sprite_index++;
-
-    /* setup the bits used for each shape/size possible */
-    int size_bits, shape_bits;
-    switch (size) {
-        case SIZE_8_8:   size_bits = 0; shape_bits = 0; break;
-        case SIZE_16_16: size_bits = 1; shape_bits = 0; break;
-        case SIZE_32_32: size_bits = 2; shape_bits = 0; break;
-        case SIZE_64_64: size_bits = 3; shape_bits = 0; break;
-        case SIZE_16_8:  size_bits = 0; shape_bits = 1; break;
-        case SIZE_32_8:  size_bits = 1; shape_bits = 1; break;
-        case SIZE_32_16: size_bits = 2; shape_bits = 1; break;
-        case SIZE_64_32: size_bits = 3; shape_bits = 1; break;
-        case SIZE_8_16:  size_bits = 0; shape_bits = 2; break;
-        case SIZE_8_32:  size_bits = 1; shape_bits = 2; break;
-        case SIZE_16_32: size_bits = 2; shape_bits = 2; break;
-        case SIZE_32_64: size_bits = 3; shape_bits = 2; break;
-    }
-
-    int h = horizontal_flip ? 1 : 0;
-    int v = vertical_flip ? 1 : 0;
-
-    /* set up the first attribute */
-    sprites[index].attribute0 = y |             /* y coordinate */
-                            (0 << 8) |          /* rendering mode */
-                            (0 << 10) |         /* gfx mode */
-                            (0 << 12) |         /* mosaic */
-                            (1 << 13) |         /* color mode, 0:16, 1:256 */
-                            (shape_bits << 14); /* shape */
-
-    /* set up the second attribute */
-    sprites[index].attribute1 = x |             /* x coordinate */
-                            (0 << 9) |          /* affine flag */
-                            (h << 12) |         /* horizontal flip flag */
-                            (v << 13) |         /* vertical flip flag */
-                            (size_bits << 14);  /* size */
-
-    /* setup the second attribute */
-    sprites[index].attribute2 = tile_index |   // tile index */
-                            (priority << 10) | // priority */
-                            (0 << 12);         // palette bank (only 16 color)*/
-
-    /* return pointer to this sprite */
-    return &sprites[index];
-}
-
-/* update all of the spries on the screen */
-void sprite_update_all() {
-    /* copy them all over */
-    memcpy16_dma((unsigned short*) sprite_attribute_memory, (unsigned short*) sprites, NUM_SPRITES * 4);
-}
-
-/* setup all sprites */
-void sprite_clear() {
-    /* clear the index counter */
-    next_sprite_index = 0;
-
-    /* move all sprites offscreen to hide them */
-    for(int i = 0; i < NUM_SPRITES; i++) {
-        sprites[i].attribute0 = SCREEN_HEIGHT;
-        sprites[i].attribute1 = SCREEN_WIDTH;
-    }
-}
-
-/* set a sprite postion */
-void sprite_position(struct Sprite* sprite, int x, int y) {
-    /* clear out the y coordinate */
-    sprite->attribute0 &= 0xff00;
-
-    /* set the new y coordinate */
-    sprite->attribute0 |= (y & 0xff);
-
-    /* clear out the x coordinate */
-    sprite->attribute1 &= 0xfe00;
-
-    /* set the new x coordinate */
-    sprite->attribute1 |= (x & 0x1ff);
-}
-
-/* move a sprite in a direction */
-void sprite_move(struct Sprite* sprite, int dx, int dy) {
-    /* get the current y coordinate */
-    int y = sprite->attribute0 & 0xff;
-
-    /* get the current x coordinate */
-    int x = sprite->attribute1 & 0x1ff;
-
-    /* move to the new location */
-    sprite_position(sprite, x + dx, y + dy);
-}
-
-/* change the vertical flip flag */
-void sprite_set_vertical_flip(struct Sprite* sprite, int vertical_flip) {
-    if (vertical_flip) {
-        /* set the bit */
-        sprite->attribute1 |= 0x2000;
-    } else {
-        /* clear the bit */
-        sprite->attribute1 &= 0xdfff;
-    }
-}
-
-/* change the vertical flip flag */
-void sprite_set_horizontal_flip(struct Sprite* sprite, int horizontal_flip) {
-    if (horizontal_flip) {
-        /* set the bit */
-        sprite->attribute1 |= 0x1000;
-    } else {
-        /* clear the bit */
-        sprite->attribute1 &= 0xefff;
-    }
-}
-
-/* change the tile offset of a sprite */
-void sprite_set_offset(struct Sprite* sprite, int offset) {
-    /* clear the old offset */
-    sprite->attribute2 &= 0xfc00;
-
-    /* apply the new one */
-    sprite->attribute2 |= (offset & 0x03ff);
-}
-
 /* setup the sprite image and palette */
 void setup_sprite_image() {
     /* load the palette from the image into palette memory*/
@@ -349,17 +120,8 @@ struct Koopa {
     /* the x and y postion */
     int x, y;
 
-    /* which frame of the animation he is on */
-    int frame;
-
-    /* the number of frames to wait before flipping */
-    int animation_delay;
-
-    /* the animation counter counts how many frames until we flip */
-    int counter;
-
-    /* whether the koopa is moving right now or not */
-    int move;
+    /* the animation clip playing on the sprite */
+    struct Anim anim;
 
     /* the number of pixels away from the edge of the screen the koopa stays */
     int border;
@@ -370,18 +132,15 @@ void koopa_init(struct Koopa* koopa) {
     koopa->x = 100;
     koopa->y = 113;
     koopa->border = 40;
-    koopa->frame = 0;
-    koopa->move = 0;
-    koopa->counter = 0;
-    koopa->animation_delay = 8;
-    koopa->sprite = sprite_init(koopa->x, koopa->y, SIZE_32_32, 0, 0, koopa->frame, 0);
+    koopa->sprite = sprite_init(koopa->x, koopa->y, SIZE_32_32, 0, 0, 0, 0);
+    anim_init(&koopa->anim, koopa->sprite, ANIM_KOOPA_STAND);
 }
 
 /* move the koopa left or right returns if it is at edge of the screen */
 int koopa_left(struct Koopa* koopa) {
     /* face left */
     sprite_set_horizontal_flip(koopa->sprite, 1);
-    koopa->move = 1;
+    anim_play(&koopa->anim, ANIM_KOOPA_WALK);
 
     /* if we are at the left end, just scroll the screen */
     if (koopa->x < koopa->border) {
@@ -395,7 +154,7 @@ int koopa_left(struct Koopa* koopa) {
 int koopa_right(struct Koopa* koopa) {
     /* face right */
     sprite_set_horizontal_flip(koopa->sprite, 0);
-    koopa->move = 1;
+    anim_play(&koopa->anim, ANIM_KOOPA_WALK);
 
     /* if we are at the right end, just scroll the screen */
     if (koopa->x > (SCREEN_WIDTH - 16 - koopa->border)) {
@@ -408,27 +167,46 @@ int koopa_right(struct Koopa* koopa) {
 }
 
 void koopa_stop(struct Koopa* koopa) {
-    koopa->move = 0;
-    koopa->frame = 0;
-    koopa->counter = 7;
-    sprite_set_offset(koopa->sprite, koopa->frame);
+    anim_play(&koopa->anim, ANIM_KOOPA_STAND);
 }
 
 /* update the koopa */
-void koopa_update(struct Koopa* koopa) {
-    if (koopa->move) {
-        koopa->counter++;
-        if (koopa->counter >= koopa->animation_delay) {
-            koopa->frame = koopa->frame + 16;
-            if (koopa->frame > 16) {
-                koopa->frame = 0;
-            }
-            sprite_set_offset(koopa->sprite, koopa->frame);
-            koopa->counter = 0;
-        }
+IWRAM_CODE void koopa_update(struct Koopa* koopa) {
+    anim_update_all(&koopa->anim, 1);
+    sprite_position(koopa->sprite, koopa->x, koopa->y);
+}
+
+/* a pair of koopas drawn as one metasprite, which paces across the top of
+ * the screen and is flipped as a whole when it turns round */
+struct KoopaPair {
+    struct Sprite* sprites;
+    int x, dx;
+};
+
+/* take the sprites for the pair */
+void pair_init(struct KoopaPair* pair) {
+    pair->sprites = sprite_reserve(koopa_pair.count);
+    pair->x = 0;
+    pair->dx = 1;
+}
+
+/* move the pair along, turning at the edges of the screen, the koopas face
+ * right unless they are flipped */
+void pair_update(struct KoopaPair* pair) {
+    if (pair->sprites == 0) {
+        return;
     }
 
-    sprite_position(koopa->sprite, koopa->x, koopa->y);
+    pair->x += pair->dx;
+    if (pair->x <= 0 || pair->x >= SCREEN_WIDTH - koopa_pair.width) {
+        pair->dx = -pair->dx;
+    }
+    metasprite_draw(pair->sprites, &koopa_pair, pair->x, 24, pair->dx < 0, 0, 0);
+}
+
+/* the vblank task which scrolls the background */
+void scroll_task(void* data) {
+    *bg0_x_scroll = *(int*) data;
 }
 
 /* the main function */
@@ -437,28 +215,72 @@ int main() {
     *display_control = MODE0 | BG0_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D;
 
     /* setup the background 0 */
-    setup_background();
+    setup_wide_map();
+    layer_reset();
+    layer_load(&background);
+
+    /* start the water moving */
+    struct TileAnim water;
+    setup_water(&water);
 
     /* setup the sprite image data */
     setup_sprite_image();
 
+    /* take over both palettes, and fade them in from black */
+    palette_load(0, bg_palette, PALETTE_SIZE);
+    palette_load(PALETTE_SIZE, bowl2_palette, PALETTE_SIZE);
+    int fade = 32;
+    palette_fade(0, fade);
+    palette_upload();
+
     /* clear all the sprites on screen now */
     sprite_clear();
 
+    /* keep the sprites lower on the screen in front */
+    sprite_sort_enable(1);
 
     /* create the koopa */
     struct Koopa koopa;
     koopa_init(&koopa);
 
+    /* and the pair which walks along the top */
+    struct KoopaPair pair;
+    pair_init(&pair);
+
     /* set initial scroll to 0 */
     int xscroll = 0;
 
-    /* loop forever */
-    while (1) {
+    /* start the music */
+    music_init();
+    music_play(&theme);
+
+    /* choose between the keypad and a recorded session */
+    input_init();
+
+    /* start timing the frames */
+    profile_init();
+
+    /* loop until the input runs out, which is never on the hardware */
+    while (input_poll()) {
+        profile_begin(PROFILE_FRAME);
+
         /* update the koopa */
+        profile_begin(PROFILE_UPDATE);
         koopa_update(&koopa);
+        pair_update(&pair);
+        tile_anim_update_all(&water, 1);
+        if (fade > 0) {
+            fade--;
+            palette_fade(0, fade);
+        }
+        palette_update();
+        profile_end(PROFILE_UPDATE);
+
+        /* play the next frame of the music */
+        music_update();
 
         /* now the arrow keys move the koopa */
+        profile_begin(PROFILE_INPUT);
         if (button_pressed(BUTTON_RIGHT)) {
             if (koopa_right(&koopa)) {
                 xscroll++;
@@ -470,14 +292,27 @@ int main() {
         } else {
             koopa_stop(&koopa);
         }
+        profile_end(PROFILE_INPUT);
+
+        /* queue up the scrolling and sprite updates for vblank */
+        vblank_add(scroll_task, &xscroll, 1, VBLANK_CRITICAL);
+        vblank_add(sprite_update_task, 0, SPRITE_OAM_WORDS, VBLANK_CRITICAL);
+        if (palette_pending()) {
+            vblank_add(palette_task, 0, palette_pending(), VBLANK_CRITICAL);
+        }
+        profile_end(PROFILE_FRAME);
 
         /* wait for vblank before scrolling and moving sprites */
         wait_vblank();
-        *bg0_x_scroll = xscroll;
-        sprite_update_all();
+        profile_begin(PROFILE_VBLANK);
+        vblank_run();
+        profile_end(PROFILE_VBLANK);
+        profile_frame();
 
         /* delay some */
         delay(100);
     }
+
+    return 0;
 }
 
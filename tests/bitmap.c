@@ -0,0 +1,151 @@
+/*
+ * bitmap.c
+ * tests for the clipping of the bitmap drawing, on small bitmaps in RAM
+ * with a border around them which nothing should be drawn into
+ */
+
+#include "gba.h"
+#include "bitmap.h"
+#include "test.h"
+
+/* the bitmaps are this many pixels, with this many halfwords from one row
+ * to the next and this many rows above and below, which is the border */
+#define WIDTH 20
+#define HEIGHT 12
+#define PITCH 32
+#define BORDER 4
+
+/* what the border and the background are filled with, and the color drawn */
+#define FILL 0x5a5a
+#define COLOR 0x21
+
+static unsigned short memory[(HEIGHT + BORDER * 2) * PITCH] __attribute__((aligned(4)));
+
+/* a 16-bit bitmap and an 8-bit one which is twice as many pixels across */
+static struct Bitmap bitmaps[2] = {
+    {memory + BORDER * PITCH, WIDTH, HEIGHT, PITCH, 16},
+    {memory + BORDER * PITCH, WIDTH * 2, HEIGHT, PITCH, 8}
+};
+
+/* the color of a pixel, or of the background */
+static unsigned int pixel(const struct Bitmap* bitmap, int x, int y) {
+    const unsigned short* row = (const unsigned short*) bitmap->pixels + y * PITCH;
+    if (bitmap->bpp == 16) {
+        return row[x];
+    }
+    return (row[x >> 1] >> ((x & 1) * 8)) & 0xff;
+}
+static unsigned int background(const struct Bitmap* bitmap) {
+    return bitmap->bpp == 16 ? FILL : (FILL & 0xff);
+}
+
+/* fill the bitmap and its border */
+static void clear() {
+    for (int i = 0; i < (HEIGHT + BORDER * 2) * PITCH; i++) {
+        memory[i] = FILL;
+    }
+}
+
+/* count the halfwords of the border which were drawn into */
+static int border_touched(const struct Bitmap* bitmap) {
+    int touched = 0;
+    int across = bitmap->bpp == 16 ? bitmap->width : bitmap->width / 2;
+    for (int y = 0; y < HEIGHT + BORDER * 2; y++) {
+        for (int x = 0; x < PITCH; x++) {
+            int inside = y >= BORDER && y < BORDER + HEIGHT && x < across;
+            touched += !inside && memory[y * PITCH + x] != FILL;
+        }
+    }
+    return touched;
+}
+
+/* check each pixel is drawn when it is in a rectangle and not otherwise */
+static void check_rect(const struct Bitmap* bitmap, int left, int top, int right, int bottom,
+        const char* what, int x0, int y0) {
+    int wrong = 0;
+    for (int y = 0; y < bitmap->height; y++) {
+        for (int x = 0; x < bitmap->width; x++) {
+            int inside = x >= left && x < right && y >= top && y < bottom;
+            wrong += pixel(bitmap, x, y) != (inside ? COLOR : background(bitmap));
+        }
+    }
+    if (wrong > 0 || border_touched(bitmap) > 0) {
+        fprintf(stderr, "%d bpp %s at %d, %d: %d pixels wrong, %d of the border drawn\n",
+                bitmap->bpp, what, x0, y0, wrong, border_touched(bitmap));
+        test_failures++;
+    }
+}
+
+int main() {
+    /* an image with a see through corner, in both depths */
+    unsigned short image16[5 * 6];
+    unsigned char image8[5 * 6];
+    for (int i = 0; i < 5 * 6; i++) {
+        image16[i] = i == 0 ? 0 : COLOR;
+        image8[i] = i == 0 ? 0 : COLOR;
+    }
+
+    for (int b = 0; b < 2; b++) {
+        const struct Bitmap* bitmap = &bitmaps[b];
+        int width = bitmap->width, height = bitmap->height;
+
+        /* rectangles in every place from all the way off the top left to all
+         * the way off the bottom right */
+        for (int y = -8; y <= height + 2; y += 3) {
+            for (int x = -8; x <= width + 2; x++) {
+                clear();
+                bitmap_rect(bitmap, x, y, 7, 5, COLOR);
+                check_rect(bitmap, x, y, x + 7, y + 5, "rectangle", x, y);
+            }
+        }
+
+        /* and images, whose see through corner is put back afterwards */
+        for (int y = -6; y <= height + 1; y += 2) {
+            for (int x = -7; x <= width + 1; x++) {
+                clear();
+                bitmap_blit(bitmap, x, y, b == 0 ? (const void*) image16 : image8, 6, 5, 0);
+                if (x >= 0 && x < width && y >= 0 && y < height) {
+                    CHECK_EQUAL(pixel(bitmap, x, y), background(bitmap));
+                    bitmap_pixel(bitmap, x, y, COLOR);
+                }
+                check_rect(bitmap, x, y, x + 6, y + 5, "image", x, y);
+            }
+        }
+
+        /* pixels off each edge are left out */
+        clear();
+        bitmap_pixel(bitmap, -1, 0, COLOR);
+        bitmap_pixel(bitmap, width, 0, COLOR);
+        bitmap_pixel(bitmap, 0, -1, COLOR);
+        bitmap_pixel(bitmap, 0, height, COLOR);
+        check_rect(bitmap, 0, 0, 0, 0, "pixels", 0, 0);
+
+        /* a line which runs off both ends draws all of the row it is on,
+         * and ones which are all off draw nothing */
+        clear();
+        bitmap_line(bitmap, -30, 3, width + 30, 3, COLOR);
+        check_rect(bitmap, 0, 3, width, 4, "line", -30, 3);
+        clear();
+        bitmap_line(bitmap, -5, -20, width + 40, -1, COLOR);
+        bitmap_line(bitmap, -1, height + 50, -1, -50, COLOR);
+        check_rect(bitmap, 0, 0, 0, 0, "lines", 0, 0);
+
+        /* a steep line through the whole bitmap is on every row */
+        clear();
+        bitmap_line(bitmap, 2, -100, 2, height + 100, COLOR);
+        check_rect(bitmap, 2, 0, 3, height, "steep line", 2, -100);
+
+        /* a triangle much bigger than the bitmap covers it and no more */
+        clear();
+        bitmap_triangle(bitmap, -500, -500, 2000, -400, -300, 3000, COLOR);
+        check_rect(bitmap, 0, 0, width, height, "triangle", -500, -500);
+
+        /* a square with its corners off the bitmap fills what is left */
+        clear();
+        struct BitmapPoint square[4] = {{-3, -2}, {5, -2}, {5, 6}, {-3, 6}};
+        bitmap_polygon(bitmap, square, 4, COLOR);
+        check_rect(bitmap, 0, 0, 5, 6, "square", -3, -2);
+    }
+
+    return test_done("bitmap");
+}
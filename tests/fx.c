@@ -0,0 +1,48 @@
+/*
+ * fx.c
+ * tests for fades landing where they were going
+ */
+
+#include "gba.h"
+#include "fx.h"
+#include "test.h"
+
+/* run a fade to the end, writing the registers each frame */
+static void finish() {
+    while (fx_fading()) {
+        fx_update();
+        fx_apply();
+    }
+}
+
+int main() {
+    fx_init();
+    fx_alpha(FX_BG1, FX_BG0, 10, 6);
+    fx_apply();
+    unsigned short alpha = *blend_control;
+
+    /* fading out goes all the way to black */
+    fx_fade_out(FX_ALL, FX_TO_BLACK, 7);
+    finish();
+    CHECK_EQUAL(*blend_fade, 16);
+
+    /* fading out again from black has nowhere to go, and stays black
+     * rather than ending up faded in */
+    fx_fade_out(FX_ALL, FX_TO_BLACK, 20);
+    finish();
+    CHECK_EQUAL(*blend_fade, 16);
+    CHECK(*blend_control != alpha);
+
+    /* fading in lands on 0 and puts the alpha blending back */
+    fx_fade_in(FX_ALL, FX_TO_BLACK, 13);
+    finish();
+    CHECK_EQUAL(*blend_fade, 0);
+    CHECK_EQUAL(*blend_control, alpha);
+
+    /* a fade too slow to move a step each frame still gets there */
+    fx_fade_out(FX_ALL, FX_TO_BLACK, 5000);
+    finish();
+    CHECK_EQUAL(*blend_fade, 16);
+
+    return test_done("fx");
+}
@@ -0,0 +1,63 @@
+/*
+ * input.c
+ * tests for recording a session into SRAM as runs and playing it back
+ */
+
+#include "gba.h"
+#include "input.h"
+#include "test.h"
+
+/* the number of frames recorded */
+#define FRAMES 70000
+
+/* the buttons down on a frame of the recording, short runs of changing
+ * buttons and then one which is too long for a run's 16-bit count */
+static unsigned short keys_for(int frame) {
+    if (frame < 1000) {
+        return (frame / 7) & BUTTON_MASK;
+    }
+    return BUTTON_A | BUTTON_RIGHT;
+}
+
+/* the runs field of the replay header */
+static unsigned int header_runs() {
+    unsigned int runs;
+    sram_read(SRAM_REPLAY_OFFSET + 8, &runs, 4);
+    return runs;
+}
+
+int main() {
+    /* with nothing in SRAM there is no replay */
+    CHECK(!input_replay_start());
+
+    /* the keypad is active low */
+    input_record_start();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        *buttons = ~keys_for(frame) & BUTTON_MASK;
+        CHECK(input_poll());
+        CHECK_EQUAL(input_buttons(), keys_for(frame));
+    }
+    input_record_stop();
+    *buttons = BUTTON_MASK;
+
+    /* each change of buttons is a run, and the long run is split in two */
+    CHECK_EQUAL(header_runs(), (1000 + 6) / 7 + 2);
+
+    /* the replay gives back the same buttons, then stops */
+    CHECK(input_replay_start());
+    int mismatches = 0;
+    for (int frame = 0; frame < FRAMES; frame++) {
+        CHECK(input_poll());
+        mismatches += input_buttons() != keys_for(frame);
+    }
+    CHECK_EQUAL(mismatches, 0);
+    CHECK_EQUAL(input_frame, FRAMES);
+    CHECK(!input_poll());
+
+    /* a header which is not a replay's is turned down */
+    unsigned char junk = 0;
+    sram_write(SRAM_REPLAY_OFFSET, &junk, 1);
+    CHECK(!input_replay_start());
+
+    return test_done("input");
+}
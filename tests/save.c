@@ -0,0 +1,88 @@
+/*
+ * save.c
+ * tests for the save record, its checksum and going between the slots
+ */
+
+#include <string.h>
+
+#include "gba.h"
+#include "save.h"
+#include "test.h"
+
+/* where the two SRAM slots are, and where the record starts in one */
+#define SLOT_SIZE (SRAM_SAVE_SIZE / 2)
+#define HEADER_SIZE 16
+
+/* save a record with a score at the top and nothing else */
+static void save_score(unsigned int score) {
+    save_add_score(score, "ABC");
+    save_commit();
+    save_flush();
+}
+
+int main() {
+    /* nothing is saved, so the defaults are loaded */
+    CHECK(!save_init());
+    CHECK_EQUAL(save_record.scores[0].score, 0);
+    CHECK_EQUAL(save_record.settings.music_volume, 16);
+
+    /* the scores are kept best first, and the names cut to three letters */
+    CHECK_EQUAL(save_add_score(50, "FIRST"), 0);
+    CHECK_EQUAL(save_add_score(70, "TOP"), 0);
+    CHECK_EQUAL(save_add_score(60, "MID"), 1);
+    CHECK_EQUAL(save_add_score(0, "NO"), -1);
+    CHECK(strcmp(save_record.scores[2].name, "FIR") == 0);
+
+    /* the replay runs grow while the buttons stay the same */
+    struct SaveReplay replay = {0};
+    save_replay_add(&replay, BUTTON_A);
+    save_replay_add(&replay, BUTTON_A);
+    save_replay_add(&replay, BUTTON_B);
+    CHECK_EQUAL(replay.runs, 2);
+    CHECK_EQUAL(replay.frames, 3);
+    CHECK_EQUAL(replay.run[0][1], 2);
+
+    /* the first record goes in slot 0 and loads back */
+    save_commit();
+    CHECK(save_step(SAVE_STEP_BYTES));
+    save_flush();
+    CHECK(!save_step(SAVE_STEP_BYTES));
+    CHECK(save_init());
+    CHECK_EQUAL(save_record.scores[0].score, 70);
+    CHECK_EQUAL(save_record.scores[1].score, 60);
+
+    /* the next one goes in slot 1, leaving slot 0 alone */
+    unsigned char slot0[SLOT_SIZE];
+    sram_read(SRAM_SAVE_OFFSET, slot0, SLOT_SIZE);
+    save_score(80);
+    CHECK(memcmp(MEM_SRAM(SRAM_SAVE_OFFSET), slot0, SLOT_SIZE) == 0);
+    CHECK(save_init());
+    CHECK_EQUAL(save_record.scores[0].score, 80);
+
+    /* a byte of the newest record going bad makes the older one load */
+    unsigned char byte;
+    sram_read(SRAM_SAVE_OFFSET + SLOT_SIZE + HEADER_SIZE, &byte, 1);
+    byte ^= 1;
+    sram_write(SRAM_SAVE_OFFSET + SLOT_SIZE + HEADER_SIZE, &byte, 1);
+    CHECK(save_init());
+    CHECK_EQUAL(save_record.scores[0].score, 70);
+
+    /* which makes slot 0 the newest, so the next record goes over the bad
+     * one in slot 1, and then the one after goes back to slot 0 */
+    save_score(90);
+    CHECK(memcmp(MEM_SRAM(SRAM_SAVE_OFFSET), slot0, SLOT_SIZE) == 0);
+    save_score(100);
+    CHECK(memcmp(MEM_SRAM(SRAM_SAVE_OFFSET), slot0, SLOT_SIZE) != 0);
+    CHECK(save_init());
+    CHECK_EQUAL(save_record.scores[0].score, 100);
+    CHECK_EQUAL(save_record.scores[1].score, 90);
+
+    /* a write which is cut off part way leaves the last good record */
+    save_add_score(110, "CUT");
+    save_commit();
+    CHECK(save_step(1));
+    CHECK(save_init());
+    CHECK_EQUAL(save_record.scores[0].score, 100);
+
+    return test_done("save");
+}
@@ -0,0 +1,44 @@
+/*
+ * test.h
+ * the checks the host unit tests are written with, a failed check prints
+ * where it was and the test goes on so one run shows every failure, and
+ * test_done gives the exit status
+ */
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+
+/* the number of checks which failed */
+static int test_failures = 0;
+
+/* check that something is true */
+#define CHECK(condition) do { \
+    if (!(condition)) { \
+        fprintf(stderr, "%s:%d: %s failed\n", __FILE__, __LINE__, #condition); \
+        test_failures++; \
+    } \
+} while (0)
+
+/* check that two integers are the same, printing both when they are not */
+#define CHECK_EQUAL(actual, expected) do { \
+    long long test_actual = (actual), test_expected = (expected); \
+    if (test_actual != test_expected) { \
+        fprintf(stderr, "%s:%d: %s is %lld, not %lld\n", __FILE__, __LINE__, \
+                #actual, test_actual, test_expected); \
+        test_failures++; \
+    } \
+} while (0)
+
+/* print how the test went and return what main should */
+static inline int test_done(const char* name) {
+    if (test_failures > 0) {
+        fprintf(stderr, "%s: %d checks failed\n", name, test_failures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
+
+#endif
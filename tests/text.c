@@ -0,0 +1,63 @@
+/*
+ * text.c
+ * tests for text_format_number, which divides by ten with a multiply
+ */
+
+#include <string.h>
+
+#include "gba.h"
+#include "text.h"
+#include "test.h"
+
+/* format a number and check it against printf */
+static void check_number(unsigned int value, int digits) {
+    char actual[11], expected[32];
+    text_format_number(actual, value, digits);
+    actual[digits] = '\0';
+
+    /* the digits which do not fit are dropped from the front */
+    snprintf(expected, sizeof(expected), "%020u", value);
+    if (strcmp(actual, expected + 20 - digits) != 0) {
+        fprintf(stderr, "%u in %d digits is %s, not %s\n", value, digits, actual,
+                expected + 20 - digits);
+        test_failures++;
+    }
+}
+
+int main() {
+    char string[4] = "xxx";
+
+    /* zeros go in front, and nothing is written past the digits */
+    text_format_number(string, 7, 2);
+    CHECK(memcmp(string, "07x", 3) == 0);
+
+    /* no digits writes nothing */
+    text_format_number(string, 123, 0);
+    CHECK(memcmp(string, "07x", 3) == 0);
+
+    /* every width around the powers of ten, and the ends of the range where
+     * the multiply would be the first to go wrong */
+    unsigned int value = 1;
+    for (int power = 0; power < 10; power++) {
+        for (int digits = 1; digits <= 10; digits++) {
+            check_number(value - 1, digits);
+            check_number(value, digits);
+            check_number(value + 1, digits);
+        }
+        value *= 10;
+    }
+    for (int digits = 1; digits <= 10; digits++) {
+        check_number(0xffffffff, digits);
+        check_number(0xfffffff9, digits);
+        check_number(0x80000000, digits);
+    }
+
+    /* and a spread of values in between */
+    value = 12345;
+    for (int i = 0; i < 10000; i++) {
+        value = value * 1103515245 + 12345;
+        check_number(value, 10);
+    }
+
+    return test_done("text");
+}
@@ -0,0 +1,89 @@
+/*
+ * vblank.c
+ * tests for the vblank queue putting work off to a later frame
+ */
+
+#include "gba.h"
+#include "profile.h"
+#include "vblank.h"
+#include "test.h"
+
+/* the number of times each task has run */
+static int runs[3];
+
+/* a task which counts itself */
+static void count_task(void* data) {
+    runs[(int*) data - runs]++;
+}
+
+/* a task which copies data around the way a level load would copy tiles
+ * into VRAM, a word takes two cycles so this is more than a whole vblank */
+#define LOAD_WORDS 0x10000
+static unsigned int load_source[LOAD_WORDS];
+static unsigned int load_dest[LOAD_WORDS];
+
+static void load_task(void* data) {
+    memcpy32_dma(load_dest, load_source, LOAD_WORDS);
+}
+
+int main() {
+    /* more words than a whole vblank has time for */
+    unsigned int huge = SCANLINES_PER_FRAME * CYCLES_PER_SCANLINE / VBLANK_CYCLES_PER_WORD;
+
+    /* the queue holds so many tasks and turns the rest down */
+    int added = 0;
+    while (vblank_add(count_task, &runs[2], 1, VBLANK_LOW)) {
+        added++;
+    }
+    CHECK_EQUAL(added, VBLANK_MAX_TASKS);
+    wait_vblank();
+    vblank_run();
+    CHECK_EQUAL(runs[2], VBLANK_MAX_TASKS);
+    runs[2] = 0;
+
+    /* small tasks all run, in order of priority */
+    wait_vblank();
+    CHECK(vblank_add(count_task, &runs[2], 1, VBLANK_LOW));
+    CHECK(vblank_add(count_task, &runs[0], 1, VBLANK_CRITICAL));
+    vblank_run();
+    CHECK_EQUAL(runs[0], 1);
+    CHECK_EQUAL(runs[2], 1);
+    CHECK_EQUAL(vblank_deferred, 0);
+    CHECK_EQUAL(vblank_overruns, 0);
+
+    /* a task which would not fit is put off, frame after frame, while the
+     * small one added after it still runs */
+    wait_vblank();
+    CHECK(vblank_add(count_task, &runs[1], huge, VBLANK_NORMAL));
+    CHECK(vblank_add(count_task, &runs[2], 1, VBLANK_LOW));
+    vblank_run();
+    CHECK_EQUAL(runs[1], 0);
+    CHECK_EQUAL(runs[2], 2);
+    CHECK_EQUAL(vblank_deferred, 1);
+    wait_vblank();
+    vblank_run();
+    CHECK_EQUAL(runs[1], 0);
+    CHECK_EQUAL(vblank_deferred, 2);
+
+    /* once the display is drawing there is no time for anything but the
+     * critical tasks, which are never put off */
+    wait_vblank();
+    while (profile_scanline() >= SCREEN_HEIGHT) { }
+    CHECK(vblank_add(count_task, &runs[2], 1, VBLANK_LOW));
+    CHECK(vblank_add(count_task, &runs[0], 1, VBLANK_CRITICAL));
+    vblank_run();
+    CHECK_EQUAL(runs[0], 2);
+    CHECK_EQUAL(runs[2], 2);
+    CHECK_EQUAL(vblank_overruns, 1);
+
+    /* a critical task which is too big for vblank runs anyway, and the
+     * frame is caught running over, both here and by the profiler */
+    wait_vblank();
+    CHECK(vblank_add(load_task, 0, LOAD_WORDS, VBLANK_CRITICAL));
+    vblank_run();
+    CHECK(vblank_end_line < SCREEN_HEIGHT);
+    CHECK_EQUAL(vblank_overruns, 2);
+    CHECK_EQUAL(profile_overruns, 2);
+
+    return test_done("vblank");
+}
@@ -0,0 +1,199 @@
+/*
+ * text.c
+ * the text layer
+ *
+ * the font is one bit per pixel in font.h, it is spread out to a 16 color
+ * tile per glyph as it is loaded, with color 1 of the layer's palette bank
+ * for the ink, each row of the map keeps the span of columns which changed
+ * since it was last copied into VRAM, so a score which goes up by one only
+ * copies the last digit or two
+ */
+
+#include "gba.h"
+#include "layer.h"
+#include "text.h"
+#include "font.h"
+
+/* the font the text layer uses */
+const struct Font text_font = {
+    font_glyphs, font_widths, font_first, font_count, font_height
+};
+
+/* the copy of the map, and the tile number and palette bits of a space */
+static unsigned short text_map[TEXT_ROWS * TEXT_COLUMNS] __attribute__((aligned(4)));
+static unsigned short text_blank = 0;
+
+/* the columns of each row which changed, left to right, none if left is
+ * not less than right */
+static unsigned char text_dirty_left[TEXT_ROWS];
+static unsigned char text_dirty_right[TEXT_ROWS];
+
+/* where the tiles and the map go in VRAM */
+static int text_char_block = 0;
+static volatile unsigned short* text_screen = 0;
+
+/* load the font, clear the map and turn the layer on */
+int text_init(const struct TextLayer* layer) {
+    volatile unsigned short* controls[4] = {
+        bg0_control, bg1_control, bg2_control, bg3_control
+    };
+
+    /* the map goes in first so the font does not take tiles under it */
+    layer_reserve_screen_blocks(layer->screen_block, 1);
+    int first = layer_alloc_tiles(layer->char_block, font_count);
+    if (first < 0) {
+        return 0;
+    }
+
+    /* spread each row of each glyph out to four bits a pixel */
+    text_char_block = layer->char_block;
+    volatile unsigned int* tiles = text_tile(first);
+    for (int i = 0; i < font_count * font_height; i++) {
+        unsigned int bits = font_glyphs[i];
+        unsigned int row = 0;
+        for (int x = 0; x < 8; x++) {
+            if (bits & (1 << x)) {
+                row |= 1 << (x * 4);
+            }
+        }
+        tiles[i] = row;
+    }
+
+    /* color 0 is see through so only the ink goes in */
+    background_palette[layer->palette_bank * 16 + 1] = layer->color;
+
+    text_blank = first | (layer->palette_bank << 12);
+    text_screen = screen_block(layer->screen_block);
+    for (int i = 0; i < TEXT_ROWS * TEXT_COLUMNS; i++) {
+        text_map[i] = text_blank;
+    }
+    for (int y = 0; y < TEXT_ROWS; y++) {
+        text_dirty_left[y] = 0;
+        text_dirty_right[y] = 0;
+    }
+    layer_copy(text_screen, text_map, sizeof(text_map));
+
+    *controls[layer->bg] = layer->priority |    /* priority, 0 is highest, 3 is lowest */
+        (layer->char_block << 2) |              /* the char block the image data is stored in */
+        (layer->screen_block << 8);             /* the screen block the tile data is stored in */
+    return 1;
+}
+
+/* put a tile in the map and mark it changed, if it did */
+static void text_set(int x, int y, unsigned short tile) {
+    if (text_map[y * TEXT_COLUMNS + x] == tile) {
+        return;
+    }
+    text_map[y * TEXT_COLUMNS + x] = tile;
+
+    if (text_dirty_left[y] >= text_dirty_right[y]) {
+        text_dirty_left[y] = x;
+        text_dirty_right[y] = x + 1;
+    } else if (x < text_dirty_left[y]) {
+        text_dirty_left[y] = x;
+    } else if (x >= text_dirty_right[y]) {
+        text_dirty_right[y] = x + 1;
+    }
+}
+
+/* take tiles from the text layer's char block */
+int text_alloc_tiles(int count) {
+    return layer_alloc_tiles(text_char_block, count);
+}
+
+/* a pointer to one of the tiles in the char block */
+volatile unsigned int* text_tile(int tile) {
+    return (volatile unsigned int*) (char_block(text_char_block) + tile * 16);
+}
+
+/* put a tile into the map */
+void text_put(int x, int y, int tile) {
+    if (x < 0 || x >= TEXT_COLUMNS || y < 0 || y >= TEXT_ROWS) {
+        return;
+    }
+    text_set(x, y, tile | (text_blank & 0xf000));
+}
+
+/* blank the whole layer */
+void text_clear() {
+    for (int y = 0; y < TEXT_ROWS; y++) {
+        for (int x = 0; x < TEXT_COLUMNS; x++) {
+            text_set(x, y, text_blank);
+        }
+    }
+}
+
+/* write a string */
+void text_print(int x, int y, const char* string) {
+    if (y < 0 || y >= TEXT_ROWS) {
+        return;
+    }
+
+    for (; *string != '\0' && x < TEXT_COLUMNS; string++, x++) {
+        int glyph = *string - font_first;
+        if (x < 0) {
+            continue;
+        }
+
+        /* anything the font does not have comes out as a space */
+        if (glyph < 0 || glyph >= font_count) {
+            glyph = 0;
+        }
+        text_set(x, y, text_blank + glyph);
+    }
+}
+
+/* turn a number into digits, the divide by ten is a multiply by 2^35 / 10
+ * rounded up and a shift, which gives the right answer for every 32-bit
+ * number, since the ARM7 has no divide instruction and the library one
+ * takes a hundred cycles or more */
+IWRAM_CODE void text_format_number(char* dest, unsigned int value, int digits) {
+    for (int i = digits - 1; i >= 0; i--) {
+        unsigned int tenth = (unsigned int) (((unsigned long long) value * 0xcccccccd) >> 35);
+        dest[i] = '0' + (value - tenth * 10);
+        value = tenth;
+    }
+}
+
+/* write a number */
+void text_print_number(int x, int y, unsigned int value, int digits) {
+    char string[11];
+    if (digits > 10) {
+        digits = 10;
+    }
+    text_format_number(string, value, digits);
+    string[digits] = '\0';
+    text_print(x, y, string);
+}
+
+/* the number of words of the map which have changed */
+int text_pending() {
+    int cells = 0;
+    for (int y = 0; y < TEXT_ROWS; y++) {
+        if (text_dirty_left[y] < text_dirty_right[y]) {
+            cells += text_dirty_right[y] - text_dirty_left[y] + 1;
+        }
+    }
+    return cells / 2;
+}
+
+/* copy the changed cells into VRAM */
+void text_upload() {
+    for (int y = 0; y < TEXT_ROWS; y++) {
+        int left = text_dirty_left[y];
+        int right = text_dirty_right[y];
+        if (left >= right) {
+            continue;
+        }
+
+        memcpy16_dma((unsigned short*) text_screen + y * TEXT_COLUMNS + left,
+                text_map + y * TEXT_COLUMNS + left, right - left);
+        text_dirty_left[y] = 0;
+        text_dirty_right[y] = 0;
+    }
+}
+
+/* the vblank task which copies the changed cells */
+void text_task(void* data) {
+    text_upload();
+}
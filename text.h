@@ -0,0 +1,84 @@
+/*
+ * text.h
+ * a text layer for scores and messages, the font goes into a char block as
+ * 16 color tiles once and printing writes tile numbers into a copy of the
+ * layer's map, only the cells which changed are copied into VRAM in vblank
+ */
+
+#ifndef TEXT_H
+#define TEXT_H
+
+/* the text layer's map is one 32x32 screen block */
+#define TEXT_COLUMNS 32
+#define TEXT_ROWS 32
+
+/* where the text layer goes and what color its text is */
+struct TextLayer {
+    /* the layer this is, 0 to 3 */
+    int bg;
+
+    /* where the font's tiles and the map go in VRAM, the font takes tiles
+     * from whatever the char block has left */
+    int char_block;
+    int screen_block;
+
+    /* the palette bank the text color goes in, and the color */
+    int palette_bank;
+    unsigned short color;
+
+    /* 0 is drawn on top, 3 underneath */
+    int priority;
+};
+
+/* a one bit per pixel font, each glyph is height rows of a byte each with
+ * bit 0 on the left */
+struct Font {
+    const unsigned char* glyphs;
+    const unsigned char* widths;
+    int first;
+    int count;
+    int height;
+};
+
+/* the font the text layer uses, from font.h */
+extern const struct Font text_font;
+
+/* load the font, clear the map and turn the layer on, returns 0 if there
+ * is not room for the font in the char block */
+int text_init(const struct TextLayer* layer);
+
+/* blank the whole layer */
+void text_clear();
+
+/* write a string with its first character at column x of row y, anything
+ * off the right of the map is left out */
+void text_print(int x, int y, const char* string);
+
+/* write the number as digits long, with zeros in front, keeping the lowest
+ * digits if it does not fit */
+void text_print_number(int x, int y, unsigned int value, int digits);
+
+/* turn a number into digits long characters, with zeros in front and no
+ * terminating zero, this needs no division */
+void text_format_number(char* dest, unsigned int value, int digits);
+
+/* take tiles from the text layer's char block for something else to draw
+ * into, returns the first or -1 if there is not room */
+int text_alloc_tiles(int count);
+
+/* a pointer to one of the tiles in the text layer's char block */
+volatile unsigned int* text_tile(int tile);
+
+/* put a tile into the map at column x of row y, in the text palette bank */
+void text_put(int x, int y, int tile);
+
+/* the number of words of the map which have changed, 0 if there are none */
+int text_pending();
+
+/* copy the changed cells of the map into VRAM */
+void text_upload();
+
+/* the vblank task which calls text_upload */
+void text_task(void* data);
+
+#endif
@@ -0,0 +1,45 @@
+/* theme.h
+ * generated by mksong program */
+
+const unsigned short theme_instruments [] = {
+    0xc380,
+    0xa040,
+    0x9100,
+    0x4100,
+};
+
+const unsigned char theme_patterns [] = {
+    0x07, 0x3c, 0x00, 0x24, 0x01, 0x48, 0x02, 0x81, 0x05, 0x40, 0x00, 0x54,
+    0x03, 0x81, 0x07, 0x43, 0x00, 0x24, 0x01, 0x48, 0x02, 0x81, 0x05, 0x40,
+    0x00, 0x54, 0x03, 0x81, 0x07, 0x41, 0x00, 0x1d, 0x01, 0x48, 0x02, 0x81,
+    0x05, 0x45, 0x00, 0x54, 0x03, 0x81, 0x07, 0x43, 0x00, 0x1f, 0x01, 0x48,
+    0x02, 0x81, 0x04, 0x54, 0x03, 0x81, 0x00, 0x07, 0x40, 0x00, 0x21, 0x01,
+    0x48, 0x02, 0x81, 0x05, 0x3e, 0x00, 0x54, 0x03, 0x81, 0x07, 0x3c, 0x00,
+    0x1f, 0x01, 0x48, 0x02, 0x81, 0x05, 0x3e, 0x00, 0x54, 0x03, 0x81, 0x07,
+    0x40, 0x00, 0x24, 0x01, 0x48, 0x02, 0x81, 0x05, 0x40, 0x00, 0x54, 0x03,
+    0x81, 0x07, 0x40, 0x00, 0x1f, 0x01, 0x48, 0x02, 0x81, 0x05, 0xff, 0x00,
+    0x54, 0x03, 0x81, 0x00, 0x04, 0x48, 0x02, 0x81, 0x04, 0x54, 0x03, 0x81,
+    0x04, 0x48, 0x02, 0x81, 0x04, 0x54, 0x03, 0x81, 0x04, 0x48, 0x02, 0x81,
+    0x04, 0x54, 0x03, 0x81, 0x04, 0x48, 0x02, 0x81, 0x04, 0x54, 0x03, 0x81,
+    0x00,
+};
+
+const unsigned short theme_pattern_offsets [] = {
+    0,
+    55,
+    112,
+};
+
+const unsigned char theme_order [] = {
+    0,
+    1,
+    0,
+    1,
+    2,
+};
+
+const struct Song theme = {
+    "theme", theme_instruments, theme_patterns, theme_pattern_offsets,
+    theme_order, 5, 8, 164
+};
+
@@ -0,0 +1,52 @@
+/*
+ * tileanim.c
+ * the background tile animation player
+ */
+
+#include "gba.h"
+#include "vblank.h"
+#include "tileanim.h"
+
+/* the vblank task which copies the frame being shown into the char block */
+static void tile_anim_task(void* data) {
+    struct TileAnim* anim = (struct TileAnim*) data;
+    memcpy16_dma((unsigned short*) anim->dest,
+            (unsigned short*) (anim->frames + anim->frame * anim->frame_size),
+            anim->frame_size);
+}
+
+/* set up an animation and copy in its first frame */
+void tile_anim_init(struct TileAnim* anim, int block, int first_tile, int tiles,
+        int colors, const void* frames, int frame_count, int duration) {
+    /* a tile is 32 bytes with 16 colors and 64 with 256 */
+    int tile_size = colors == 256 ? 32 : 16;
+
+    anim->dest = char_block(block) + first_tile * tile_size;
+    anim->frames = (const unsigned short*) frames;
+    anim->frame_size = tiles * tile_size;
+    anim->frame_count = frame_count;
+    anim->duration = duration;
+    anim->frame = 0;
+    anim->timer = duration;
+    tile_anim_task(anim);
+}
+
+/* advance a number of animations by one game frame */
+IWRAM_CODE void tile_anim_update_all(struct TileAnim* anims, int count) {
+    for (int i = 0; i < count; i++) {
+        struct TileAnim* anim = &anims[i];
+        if (--anim->timer != 0) {
+            continue;
+        }
+
+        anim->timer = anim->duration;
+        anim->frame++;
+        if (anim->frame == anim->frame_count) {
+            anim->frame = 0;
+        }
+
+        /* a late copy only shows the old tiles for a little longer, so
+         * these can wait if vblank is busy */
+        vblank_add(tile_anim_task, anim, anim->frame_size / 2, VBLANK_NORMAL);
+    }
+}
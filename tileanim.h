@@ -0,0 +1,40 @@
+/*
+ * tileanim.h
+ * background tile animation, the map stays where it is and the tiles it
+ * points at are replaced in the char block on a schedule, so water or
+ * flickering lights only cost a few tiles of copying per animation frame
+ */
+
+#ifndef TILEANIM_H
+#define TILEANIM_H
+
+#include "gba.h"
+
+/* a run of tiles in a char block which steps through a number of frames,
+ * the image data has each frame's tiles one after another */
+struct TileAnim {
+    /* where the tiles go and the data for every frame */
+    volatile unsigned short* dest;
+    const unsigned short* frames;
+
+    /* the size of one frame's tiles in halfwords */
+    unsigned short frame_size;
+
+    /* the number of frames, how many game frames each is shown for, the
+     * frame being shown and the game frames left until the next one */
+    unsigned char frame_count;
+    unsigned char duration;
+    unsigned char frame;
+    unsigned char timer;
+};
+
+/* set up an animation on the tiles from first_tile on in a char block, colors is 16
+ * or 256 to match the layer, the first frame is copied straight away */
+void tile_anim_init(struct TileAnim* anim, int block, int first_tile, int tiles,
+        int colors, const void* frames, int frame_count, int duration);
+
+/* advance a number of animations by one game frame, and queue the tiles of
+ * the ones which changed frame to be copied in vblank */
+IWRAM_CODE void tile_anim_update_all(struct TileAnim* anims, int count);
+
+#endif
@@ -0,0 +1,344 @@
+/*
+ * drawbench.c
+ * times the bitmap drawing against drawing the same pixels one at a time
+ * with put_pixel the way game.c does, on the host shim, and prints the
+ * pixels each draws a cycle under the shim's cycle model, which is an
+ * estimate, so it is the ratio between them which means something
+ *
+ * each test is first drawn once each way onto a cleared page, and if the
+ * two pages are not the same it stops with an error
+ *
+ * usage: drawbench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gba.h"
+#include "host.h"
+#include "bitmap.h"
+#include "blit.h"
+#include "bowl2.h"
+
+/* how many times each test is drawn */
+#define REPEATS 2000
+
+/* the bowl, with its 8x8 tiles put back into rows, in palette indices and
+ * in colors */
+static unsigned char bowl8[bowl2_width * bowl2_height];
+static unsigned short bowl16[bowl2_width * bowl2_height];
+
+/* the per pixel path, put_pixel from game.c and the same thing for the
+ * 16-bit modes, they are kept out of line as they are there */
+__attribute__((noinline)) static void put_pixel(volatile unsigned short* buffer, int row,
+        int col, unsigned char color) {
+    unsigned short offset = (row * SCREEN_WIDTH + col) >> 1;
+    unsigned short pixel = buffer[offset];
+    if (col & 1) {
+        buffer[offset] = (color << 8) | (pixel & 0x00ff);
+    } else {
+        buffer[offset] = (pixel & 0xff00) | color;
+    }
+}
+
+__attribute__((noinline)) static void put_pixel16(volatile unsigned short* buffer, int pitch,
+        int row, int col, unsigned short color) {
+    buffer[row * pitch + col] = color;
+}
+
+/* one pixel with whichever of the two fits the mode */
+static void slow_pixel(int x, int y, unsigned int color) {
+    if (bitmap_screen.bpp == 8) {
+        put_pixel(bitmap_screen.pixels, y, x, color);
+    } else {
+        put_pixel16(bitmap_screen.pixels, bitmap_screen.pitch, y, x, color);
+    }
+}
+
+/* the tests, each drawn with put_pixel and with the bitmap module, they
+ * return the number of pixels they drew */
+static int slow_rect() {
+    for (int y = 21; y < 21 + 64; y++) {
+        for (int x = 37; x < 37 + 64; x++) {
+            slow_pixel(x, y, 5);
+        }
+    }
+    return 64 * 64;
+}
+
+static int fast_rect() {
+    bitmap_rect(&bitmap_screen, 37, 21, 64, 64, 5);
+    return 64 * 64;
+}
+
+/* a square hanging off the bottom left corner, as update_screen in game.c
+ * draws them, the safe way to do it one pixel at a time is to check each
+ * one */
+#define EDGE_X -20
+#define EDGE_Y 120
+#define EDGE_SIZE 54
+
+static int slow_edge() {
+    int pixels = 0;
+    for (int y = EDGE_Y; y < EDGE_Y + EDGE_SIZE; y++) {
+        for (int x = EDGE_X; x < EDGE_X + EDGE_SIZE; x++) {
+            if ((unsigned int) x < (unsigned int) bitmap_screen.width &&
+                    (unsigned int) y < (unsigned int) bitmap_screen.height) {
+                slow_pixel(x, y, 9);
+                pixels++;
+            }
+        }
+    }
+    return pixels;
+}
+
+static int fast_edge() {
+    int right = EDGE_X + EDGE_SIZE, bottom = EDGE_Y + EDGE_SIZE;
+    if (bottom > bitmap_screen.height) {
+        bottom = bitmap_screen.height;
+    }
+    bitmap_rect(&bitmap_screen, EDGE_X, EDGE_Y, EDGE_SIZE, EDGE_SIZE, 9);
+    return right * (bottom - EDGE_Y);
+}
+
+/* the ends of the lines, a fan out from near the middle of the screen */
+static void line_end(int i, int* x, int* y) {
+    int w = bitmap_screen.width - 1;
+    int h = bitmap_screen.height - 1;
+    if (i < 16) {
+        *x = i * w / 15;
+        *y = 0;
+    } else {
+        *x = w;
+        *y = (i - 16) * h / 15;
+    }
+}
+
+static int slow_lines() {
+    int pixels = 0;
+    for (int i = 0; i < 32; i++) {
+        int x0 = bitmap_screen.width / 2, y0 = bitmap_screen.height / 2, x1, y1;
+        line_end(i, &x1, &y1);
+        int dx = abs(x1 - x0), dy = -abs(y1 - y0);
+        int sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+        int error = dx + dy;
+        for (;;) {
+            slow_pixel(x0, y0, 7);
+            pixels++;
+            if (x0 == x1 && y0 == y1) {
+                break;
+            }
+            int twice = error * 2;
+            if (twice >= dy) {
+                error += dy;
+                x0 += sx;
+            }
+            if (twice <= dx) {
+                error += dx;
+                y0 += sy;
+            }
+        }
+    }
+    return pixels;
+}
+
+static int fast_lines() {
+    int pixels = 0;
+    for (int i = 0; i < 32; i++) {
+        int x0 = bitmap_screen.width / 2, y0 = bitmap_screen.height / 2, x1, y1;
+        line_end(i, &x1, &y1);
+        bitmap_line(&bitmap_screen, x0, y0, x1, y1, 7);
+        int dx = abs(x1 - x0), dy = abs(y1 - y0);
+        pixels += (dx > dy ? dx : dy) + 1;
+    }
+    return pixels;
+}
+
+/* a fan of triangles around the middle of the screen, the per pixel way
+ * tests the middle of each pixel in a triangle's bounding box against its
+ * three edges, the pixels it draws are kept for the bitmap way to return */
+static int poly_pixels;
+
+static void triangle_corners(int i, int* x, int* y) {
+    int w = bitmap_screen.width - 1, h = bitmap_screen.height - 1;
+    int corners[8][2] = {
+        {w / 2, 0}, {w, h / 4}, {w, h * 3 / 4}, {w / 2, h},
+        {0, h * 3 / 4}, {0, h / 4}, {w / 4, 0}, {w / 2, 0}
+    };
+    x[0] = w / 2;
+    y[0] = h / 2;
+    x[1] = corners[i][0];
+    y[1] = corners[i][1];
+    x[2] = corners[(i + 1) % 8][0];
+    y[2] = corners[(i + 1) % 8][1];
+}
+
+/* which side of the edge from a to b a point is, in half pixels */
+static int side(int ax, int ay, int bx, int by, int px, int py) {
+    return (bx - ax) * 2 * (py - ay * 2) - (by - ay) * 2 * (px - ax * 2);
+}
+
+/* whether a point is inside an edge of a triangle which goes round the way
+ * sign says, a point on the edge is inside if it is a left edge, which is
+ * how bitmap_polygon fills */
+static int inside(int ax, int ay, int bx, int by, int px, int py, int sign) {
+    int e = side(ax, ay, bx, by, px, py) * sign;
+    return e > 0 || (e == 0 && (ay - by) * sign > 0);
+}
+
+static int slow_poly() {
+    int pixels = 0;
+    for (int i = 0; i < 7; i++) {
+        int x[3], y[3];
+        triangle_corners(i, x, y);
+        int left = x[0], right = x[0], top = y[0], bottom = y[0];
+        for (int j = 1; j < 3; j++) {
+            left = x[j] < left ? x[j] : left;
+            right = x[j] > right ? x[j] : right;
+            top = y[j] < top ? y[j] : top;
+            bottom = y[j] > bottom ? y[j] : bottom;
+        }
+        int sign = side(x[0], y[0], x[1], y[1], x[2] * 2, y[2] * 2) > 0 ? 1 : -1;
+        for (int py = top; py <= bottom; py++) {
+            for (int px = left; px <= right; px++) {
+                int mx = px * 2 + 1, my = py * 2 + 1;
+                if (inside(x[0], y[0], x[1], y[1], mx, my, sign) &&
+                        inside(x[1], y[1], x[2], y[2], mx, my, sign) &&
+                        inside(x[2], y[2], x[0], y[0], mx, my, sign)) {
+                    slow_pixel(px, py, 3 + i);
+                    pixels++;
+                }
+            }
+        }
+    }
+    poly_pixels = pixels;
+    return pixels;
+}
+
+static int fast_poly() {
+    for (int i = 0; i < 7; i++) {
+        int x[3], y[3];
+        triangle_corners(i, x, y);
+        bitmap_triangle(&bitmap_screen, x[0], y[0], x[1], y[1], x[2], y[2], 3 + i);
+    }
+    return poly_pixels;
+}
+
+/* the bowl at an odd x, key color 0 */
+static int slow_blit() {
+    int pixels = 0;
+    for (int y = 0; y < bowl2_height; y++) {
+        for (int x = 0; x < bowl2_width; x++) {
+            unsigned int color = bitmap_screen.bpp == 8 ? bowl8[y * bowl2_width + x] :
+                bowl16[y * bowl2_width + x];
+            if (bowl8[y * bowl2_width + x] != 0) {
+                slow_pixel(51 + x, 40 + y, color);
+                pixels++;
+            }
+        }
+    }
+    return pixels;
+}
+
+static int fast_blit() {
+    int pixels = 0;
+    if (bitmap_screen.bpp == 8) {
+        bitmap_blit(&bitmap_screen, 51, 40, bowl8, bowl2_width, bowl2_height, 0);
+    } else {
+        bitmap_blit(&bitmap_screen, 51, 40, bowl16, bowl2_width, bowl2_height, 0);
+    }
+    for (int i = 0; i < bowl2_width * bowl2_height; i++) {
+        pixels += bowl8[i] != 0;
+    }
+    return pixels;
+}
+
+/* the bowl at the same place drawn by its compiled sprite, mode 4 only */
+static int fast_sprite() {
+    int pixels = 0;
+    blit_sprite(&bitmap_screen, &bowl_sprites[0], 51, 40);
+    for (int i = 0; i < bowl2_width * bowl2_height; i++) {
+        pixels += bowl8[i] != 0;
+    }
+    return pixels;
+}
+
+/* the page drawn by the put_pixel way of a test, to check the bitmap way
+ * against */
+static unsigned short reference[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+/* clear the page being drawn into */
+static void clear_page() {
+    for (int i = 0; i < bitmap_screen.height * bitmap_screen.pitch; i++) {
+        bitmap_screen.pixels[i] = 0;
+    }
+}
+
+/* draw a test both ways onto a cleared page and stop if they differ */
+static void check(const char* name, int mode, int (*slow)(), int (*fast)()) {
+    int size = bitmap_screen.height * bitmap_screen.pitch;
+
+    clear_page();
+    slow();
+    for (int i = 0; i < size; i++) {
+        reference[i] = bitmap_screen.pixels[i];
+    }
+
+    clear_page();
+    fast();
+    for (int i = 0; i < size; i++) {
+        if (bitmap_screen.pixels[i] != reference[i]) {
+            fprintf(stderr, "%s mode %d: the bitmap way drew 0x%04x at row %d halfword %d, "
+                    "put_pixel drew 0x%04x\n", name, mode, bitmap_screen.pixels[i],
+                    i / bitmap_screen.pitch, i % bitmap_screen.pitch, reference[i]);
+            exit(1);
+        }
+    }
+}
+
+/* time a test and return the pixels a cycle */
+static double bench(int (*test)()) {
+    int pixels = 0;
+    unsigned int start = host_cycles();
+    for (int i = 0; i < REPEATS; i++) {
+        pixels += test();
+    }
+    return pixels / (double) (host_cycles() - start);
+}
+
+/* check both ways of drawing a test match, then time them and print them */
+static void compare(const char* name, int mode, int (*slow)(), int (*fast)()) {
+    check(name, mode, slow, fast);
+    double slow_rate = bench(slow);
+    double fast_rate = bench(fast);
+    printf("%-6s mode %d  put_pixel %6.4f  bitmap %6.4f pixels a cycle  %5.1fx\n",
+            name, mode, slow_rate, fast_rate, fast_rate / slow_rate);
+}
+
+int main() {
+    /* put the bowl's tiles back into rows */
+    for (int y = 0; y < bowl2_height; y++) {
+        for (int x = 0; x < bowl2_width; x++) {
+            int tile = (y / 8) * (bowl2_width / 8) + x / 8;
+            unsigned char index = bowl2_data[tile * 64 + (y % 8) * 8 + x % 8];
+            bowl8[y * bowl2_width + x] = index;
+            /* the top bit of a color is not shown, so setting it keeps
+             * black apart from the key */
+            bowl16[y * bowl2_width + x] = index == 0 ? 0 : bowl2_palette[index] | 0x8000;
+        }
+    }
+
+    int modes[3] = {MODE3, MODE4, MODE5};
+    for (int i = 0; i < 3; i++) {
+        bitmap_init(modes[i]);
+        compare("rect", modes[i], slow_rect, fast_rect);
+        compare("edge", modes[i], slow_edge, fast_edge);
+        compare("lines", modes[i], slow_lines, fast_lines);
+        compare("poly", modes[i], slow_poly, fast_poly);
+        compare("blit", modes[i], slow_blit, fast_blit);
+        if (modes[i] == MODE4) {
+            compare("sprite", modes[i], slow_blit, fast_sprite);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+#!/bin/sh
+# iwram-report.sh
+# print how much of the 32K of IWRAM a GBA build uses, from its linker map
+# file, with the size of each function that IWRAM_CODE put there
+#
+# usage: tools/iwram-report.sh sprites.map
+
+if [ $# -ne 1 ]; then
+    echo "usage: $0 file.map" >&2
+    exit 1
+fi
+
+awk '
+# turn a 0x hex number into a value, since not every awk has strtonum
+function hex(s,    i, v) {
+    v = 0
+    s = tolower(s)
+    for (i = 3; i <= length(s); i++) {
+        v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+    }
+    return v
+}
+
+# output sections start in the first column, the name can be on a line of
+# its own with the address and size on the next one
+/^\.[A-Za-z0-9_.]+/ {
+    section = $1
+    if (NF == 1) {
+        getline
+        address = $1; size = $2
+    } else {
+        address = $2; size = $3
+    }
+    in_iwram = (address ~ /^0x0*3[0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f][0-9a-f]$/)
+    if (in_iwram && hex(size) > 0) {
+        sections[section] += hex(size)
+        total += hex(size)
+    }
+    in_code = (section == ".iwram")
+    next
+}
+
+# inside the .iwram section the symbols are listed by address, so each
+# function runs up to the next symbol or the end of its input section
+in_code && /^ \.iwram/ {
+    end = hex($2) + hex($3)
+    last = ""
+    next
+}
+in_code && /^ +0x[0-9a-f]+ +[A-Za-z_][A-Za-z0-9_]*$/ {
+    a = hex($1)
+    if (last != "") {
+        functions[last] = a - last_address
+    }
+    last = $2; last_address = a
+    functions[last] = end - a
+    next
+}
+
+END {
+    printf "%-24s %8s\n", "section", "bytes"
+    for (s in sections) {
+        printf "%-24s %8d\n", s, sections[s]
+    }
+    printf "\n%-24s %8s\n", "IWRAM_CODE function", "bytes"
+    for (f in functions) {
+        printf "%-24s %8d\n", f, functions[f]
+    }
+    printf "\n%d of 32768 bytes of IWRAM used (%d%%)\n", total, total * 100 / 32768
+}
+' "$1"
@@ -0,0 +1,119 @@
+/*
+ * mkaffine.c
+ * turns a text picture of an affine layer's map into the byte per tile map
+ * the hardware reads
+ *
+ * the first line is the map's name and its size in tiles, which is 16, 32,
+ * 64 or 128, then each "tile" line says which tile a character stands for,
+ * and the rest of the lines are the rows of the map, lines starting with #
+ * are comments:
+ *
+ *     floor 16
+ *     tile . 0
+ *     tile o 3
+ *     ....oooo....oooo
+ *
+ * usage: mkaffine floor.txt floor.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* the biggest map, 1024 pixels on a side */
+#define MAX_SIZE 128
+
+static unsigned char map[MAX_SIZE * MAX_SIZE];
+
+int main(int argc, char** argv) {
+    char line[1024], name[64] = "";
+    int tiles[256];
+    int size = 0, rows = 0, line_number = 0;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s floor.txt floor.h\n", argv[0]);
+        return 1;
+    }
+
+    FILE* in = fopen(argv[1], "r");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    for (int i = 0; i < 256; i++) {
+        tiles[i] = -1;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0') {
+            continue;
+        }
+
+        /* the name and size come first */
+        if (size == 0) {
+            if (sscanf(line, "%63s %d", name, &size) != 2 ||
+                    (size != 16 && size != 32 && size != 64 && size != 128)) {
+                fprintf(stderr, "%s:%d: expected a name and a size of 16, 32, 64 or 128\n",
+                        argv[1], line_number);
+                return 1;
+            }
+            continue;
+        }
+
+        /* then what each character stands for */
+        char c;
+        int tile;
+        if (strncmp(line, "tile ", 5) == 0) {
+            if (sscanf(line + 5, "%c %d", &c, &tile) != 2 || tile < 0 || tile > 255) {
+                fprintf(stderr, "%s:%d: bad tile\n", argv[1], line_number);
+                return 1;
+            }
+            tiles[(unsigned char) c] = tile;
+            continue;
+        }
+
+        /* and the rows of the map */
+        if ((int) strlen(line) != size || rows == size) {
+            fprintf(stderr, "%s:%d: rows must be %d characters and there must be %d of them\n",
+                    argv[1], line_number, size, size);
+            return 1;
+        }
+        for (int x = 0; x < size; x++) {
+            tile = tiles[(unsigned char) line[x]];
+            if (tile < 0) {
+                fprintf(stderr, "%s:%d: no tile for '%c'\n", argv[1], line_number, line[x]);
+                return 1;
+            }
+            map[rows * size + x] = tile;
+        }
+        rows++;
+    }
+    fclose(in);
+
+    if (rows != size) {
+        fprintf(stderr, "%s: %d rows for a map of size %d\n", argv[1], rows, size);
+        return 1;
+    }
+
+    FILE* out = fopen(argv[2], "w");
+    if (out == NULL) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    /* the map is word aligned so the layer loader can copy it a word at a
+     * time */
+    fprintf(out, "/* %s\n * generated by mkaffine program */\n\n", argv[2]);
+    fprintf(out, "#define %s_size %d\n\n", name, size);
+    fprintf(out, "const unsigned char %s_map [] __attribute__((aligned(4))) = {\n", name);
+    for (int i = 0; i < size * size; i++) {
+        fprintf(out, "%s0x%02x,%s", i % 16 == 0 ? "    " : "", map[i],
+                i % 16 == 15 ? "\n" : " ");
+    }
+    fprintf(out, "};\n\n");
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * mkanim.c
+ * turns a text list of animation clips into the anims.h tables which anim.c
+ * plays back
+ *
+ * each line is a clip name, how it plays (loop, once or pingpong) and its
+ * frames as tile:duration pairs, # starts a comment:
+ *
+ *     koopa_walk loop 16:8 0:8
+ *
+ * ping-pong clips are unrolled into a loop here, so the player only ever
+ * has to follow each frame's next index, the last frame of a play once
+ * clip has ANIM_END for its next index, where the player stops
+ *
+ * usage: mkanim anims.txt anims.h
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* the most clips and frames in total */
+#define MAX_CLIPS 256
+#define MAX_FRAMES 4096
+
+/* the frames and clips read so far */
+static int frame_tile[MAX_FRAMES], frame_duration[MAX_FRAMES], frame_next[MAX_FRAMES];
+static int frame_count = 0;
+static char clip_name[MAX_CLIPS][64];
+static int clip_first[MAX_CLIPS];
+static int clip_count = 0;
+
+/* add a frame, returns its index */
+static int add_frame(int tile, int duration) {
+    frame_tile[frame_count] = tile;
+    frame_duration[frame_count] = duration;
+    frame_next[frame_count] = frame_count + 1;
+    return frame_count++;
+}
+
+int main(int argc, char** argv) {
+    char line[1024], name[64], mode[16];
+    int tiles[256], durations[256];
+    int line_number = 0;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s anims.txt anims.h\n", argv[0]);
+        return 1;
+    }
+
+    FILE* in = fopen(argv[1], "r");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        line_number++;
+
+        char* comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+
+        int used;
+        if (sscanf(line, "%63s %15s%n", name, mode, &used) != 2) {
+            continue;
+        }
+
+        /* read the tile:duration pairs */
+        int count = 0, n;
+        char* p = line + used;
+        while (count < 256 && sscanf(p, "%d:%d%n", &tiles[count], &durations[count], &n) == 2) {
+            if (tiles[count] < 0 || tiles[count] > 1023 ||
+                    durations[count] < 1 || durations[count] > 255) {
+                fprintf(stderr, "%s:%d: frame out of range\n", argv[1], line_number);
+                return 1;
+            }
+            count++;
+            p += n;
+        }
+        if (count == 0 || clip_count == MAX_CLIPS || frame_count + 2 * count > MAX_FRAMES) {
+            fprintf(stderr, "%s:%d: bad clip\n", argv[1], line_number);
+            return 1;
+        }
+
+        strcpy(clip_name[clip_count], name);
+        int first = frame_count;
+        clip_first[clip_count++] = first;
+
+        for (int i = 0; i < count; i++) {
+            add_frame(tiles[i], durations[i]);
+        }
+        if (strcmp(mode, "loop") == 0) {
+            frame_next[frame_count - 1] = first;
+        } else if (strcmp(mode, "once") == 0) {
+            frame_next[frame_count - 1] = -1;
+        } else if (strcmp(mode, "pingpong") == 0) {
+            for (int i = count - 2; i > 0; i--) {
+                add_frame(tiles[i], durations[i]);
+            }
+            frame_next[frame_count - 1] = first;
+        } else {
+            fprintf(stderr, "%s:%d: unknown mode %s\n", argv[1], line_number, mode);
+            return 1;
+        }
+    }
+    fclose(in);
+
+    FILE* out = fopen(argv[2], "w");
+    if (out == NULL) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    fprintf(out, "/* %s\n * generated by mkanim program */\n\n", argv[2]);
+    for (int i = 0; i < clip_count; i++) {
+        fprintf(out, "#define ANIM_");
+        for (char* c = clip_name[i]; *c; c++) {
+            fputc(toupper((unsigned char) *c), out);
+        }
+        fprintf(out, " %d\n", i);
+    }
+
+    fprintf(out, "\nconst struct AnimFrame anim_frames [] = {\n");
+    for (int i = 0; i < frame_count; i++) {
+        if (frame_next[i] < 0) {
+            fprintf(out, "    {%d, ANIM_END, %d},\n", frame_tile[i], frame_duration[i]);
+        } else {
+            fprintf(out, "    {%d, %d, %d},\n", frame_tile[i], frame_next[i], frame_duration[i]);
+        }
+    }
+    fprintf(out, "};\n\nconst unsigned short anim_clips [] = {\n");
+    for (int i = 0; i < clip_count; i++) {
+        fprintf(out, "    %d,\n", clip_first[i]);
+    }
+    fprintf(out, "};\n\n");
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ * mkblit.c
+ * turns the bowl and the falling objects into compiled sprites for mode 4,
+ * functions which store each opaque pixel of the image straight into the
+ * page with no loops, reads or tests
+ *
+ * the images are the 256 color tiles from bowl2.h and objects.h, color 0 is
+ * see through, each image gets a function for each of the four places its
+ * left edge can be in a word, so four pixels in a row which land in the
+ * same word are one 32-bit store, two which share a halfword are one 16-bit
+ * store, and only a pixel whose neighbour in the halfword is see through
+ * has to read the halfword and merge into it
+ *
+ * usage: mkblit blits.h
+ */
+
+#include <stdio.h>
+
+#include "../bowl2.h"
+#include "../objects.h"
+
+/* the bytes from one row of the mode 4 page to the next */
+#define PAGE_PITCH 240
+
+/* the images are cut into 32x32 frames */
+#define FRAME_SIZE 32
+
+/* the frame being generated, with its tiles put back into rows */
+static unsigned char pixels[FRAME_SIZE * FRAME_SIZE];
+
+/* the number of stores and merges in the function being generated */
+static int stores, merges;
+
+/* put the tiles of a frame of a 32 pixel wide tiled image back into rows */
+static void untile(const unsigned char* data, int frame) {
+    for (int y = 0; y < FRAME_SIZE; y++) {
+        for (int x = 0; x < FRAME_SIZE; x++) {
+            int image_y = frame * FRAME_SIZE + y;
+            int tile = (image_y / 8) * (FRAME_SIZE / 8) + x / 8;
+            pixels[y * FRAME_SIZE + x] = data[tile * 64 + (image_y % 8) * 8 + x % 8];
+        }
+    }
+}
+
+/* the pixel of the row which lands on a byte of the page, or 0 */
+static int pixel_at(int y, int phase, int byte) {
+    int x = byte - phase;
+    if (x < 0 || x >= FRAME_SIZE) {
+        return 0;
+    }
+    return pixels[y * FRAME_SIZE + x];
+}
+
+/* write the stores for a halfword of a row */
+static void write_halfword(FILE* out, int offset, int low, int high) {
+    if (low && high) {
+        fprintf(out, "    HALF(%d) = 0x%04x;\n", offset, low | (high << 8));
+        stores++;
+    } else if (low) {
+        fprintf(out, "    HALF(%d) = (HALF(%d) & 0xff00) | 0x%02x;\n", offset, offset, low);
+        merges++;
+    } else if (high) {
+        fprintf(out, "    HALF(%d) = (HALF(%d) & 0x00ff) | 0x%04x;\n", offset, offset, high << 8);
+        merges++;
+    }
+}
+
+/* write the function which draws the frame with its left edge at a byte
+ * phase of a word, dest is the word the left edge is in */
+static void write_function(FILE* out, const char* name, int frame, int phase) {
+    int skipped = 0;
+
+    stores = 0;
+    merges = 0;
+    fprintf(out, "static void blit_%s_%d_%d(volatile unsigned char* dest) {\n", name, frame, phase);
+
+    for (int y = 0; y < FRAME_SIZE; y++) {
+        int any = 0;
+        for (int x = 0; x < FRAME_SIZE; x++) {
+            any |= pixels[y * FRAME_SIZE + x];
+        }
+        if (!any) {
+            skipped++;
+            continue;
+        }
+
+        /* move down to this row */
+        if (stores + merges > 0 || skipped > 0) {
+            fprintf(out, "    dest += %d;\n", (skipped + (stores + merges > 0)) * PAGE_PITCH);
+        }
+        skipped = 0;
+
+        for (int word = 0; word < FRAME_SIZE + phase; word += 4) {
+            int p[4];
+            for (int i = 0; i < 4; i++) {
+                p[i] = pixel_at(y, phase, word + i);
+            }
+            if (p[0] && p[1] && p[2] && p[3]) {
+                fprintf(out, "    WORD(%d) = 0x%02x%02x%02x%02x;\n", word, p[3], p[2], p[1], p[0]);
+                stores++;
+            } else {
+                write_halfword(out, word, p[0], p[1]);
+                write_halfword(out, word + 2, p[2], p[3]);
+            }
+        }
+    }
+
+    fprintf(out, "    /* %d stores and %d merges */\n", stores, merges);
+    fprintf(out, "}\n\n");
+}
+
+/* write the functions for a frame and the pixels for drawing it clipped */
+static void write_frame(FILE* out, const char* name, const unsigned char* data, int frame) {
+    untile(data, frame);
+
+    int opaque = 0;
+    for (int i = 0; i < FRAME_SIZE * FRAME_SIZE; i++) {
+        opaque += pixels[i] != 0;
+    }
+
+    fprintf(out, "/* %s frame %d, %d opaque pixels */\n", name, frame, opaque);
+    fprintf(out, "static const unsigned char %s_%d_pixels [] = {\n", name, frame);
+    for (int i = 0; i < FRAME_SIZE * FRAME_SIZE; i++) {
+        fprintf(out, "%s0x%02x,%s", i % 16 == 0 ? "    " : "", pixels[i],
+                i % 16 == 15 ? "\n" : " ");
+    }
+    fprintf(out, "};\n\n");
+
+    for (int phase = 0; phase < 4; phase++) {
+        write_function(out, name, frame, phase);
+    }
+}
+
+/* write the descriptor of a frame */
+static void write_sprite(FILE* out, const char* name, int frame) {
+    fprintf(out, "    {%d, %d, %s_%d_pixels, {", FRAME_SIZE, FRAME_SIZE, name, frame);
+    for (int phase = 0; phase < 4; phase++) {
+        fprintf(out, "blit_%s_%d_%d%s", name, frame, phase, phase < 3 ? ", " : "");
+    }
+    fprintf(out, "}},\n");
+}
+
+int main(int argc, char** argv) {
+    int object_frames = objects_height / FRAME_SIZE;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s blits.h\n", argv[0]);
+        return 1;
+    }
+
+    FILE* out = fopen(argv[1], "w");
+    if (out == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(out, "/* %s\n * generated by mkblit program */\n\n", argv[1]);
+    fprintf(out, "#include \"blit.h\"\n\n");
+    fprintf(out, "/* the halfword and the word a number of bytes into the page */\n");
+    fprintf(out, "#define HALF(offset) (*(volatile unsigned short*) (dest + (offset)))\n");
+    fprintf(out, "#define WORD(offset) (*(volatile unsigned int*) (dest + (offset)))\n\n");
+
+    write_frame(out, "bowl", bowl2_data, 0);
+    for (int frame = 0; frame < object_frames; frame++) {
+        write_frame(out, "object", objects_data, frame);
+    }
+
+    fprintf(out, "const struct CompiledSprite bowl_sprites [] = {\n");
+    write_sprite(out, "bowl", 0);
+    fprintf(out, "};\n\n");
+    fprintf(out, "const struct CompiledSprite object_sprites [] = {\n");
+    for (int frame = 0; frame < object_frames; frame++) {
+        write_sprite(out, "object", frame);
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "#undef HALF\n");
+    fprintf(out, "#undef WORD\n");
+    fclose(out);
+    return 0;
+}
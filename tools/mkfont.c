@@ -0,0 +1,157 @@
+/*
+ * mkfont.c
+ * turns a text picture of a font into the one bit per pixel glyphs and the
+ * glyph widths the text layer and the variable width text use
+ *
+ * the first line is the font's name, then each glyph is a "glyph" line with
+ * its character, or "space", and maybe its width, followed by up to 8 rows
+ * with X for the ink and anything else for none, lines starting with # are
+ * comments:
+ *
+ *     font font
+ *     glyph space 3
+ *     glyph i
+ *     X
+ *     .
+ *     X
+ *
+ * a glyph without a width is as wide as its ink plus a pixel between it and
+ * the next one, the glyphs go from space up to ~ and any which are left out
+ * are blank
+ *
+ * usage: mkfont font.txt font.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* the characters the font covers, and the height of every glyph */
+#define FIRST_CHAR 32
+#define LAST_CHAR 126
+#define GLYPHS (LAST_CHAR - FIRST_CHAR + 1)
+#define GLYPH_HEIGHT 8
+
+static unsigned char glyphs[GLYPHS][GLYPH_HEIGHT];
+static int widths[GLYPHS];
+
+int main(int argc, char** argv) {
+    char line[256], name[64] = "";
+    int glyph = -1, rows = 0, line_number = 0;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s font.txt font.h\n", argv[0]);
+        return 1;
+    }
+
+    FILE* in = fopen(argv[1], "r");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    for (int i = 0; i < GLYPHS; i++) {
+        widths[i] = -1;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0') {
+            continue;
+        }
+
+        /* the name comes first */
+        if (name[0] == '\0') {
+            if (sscanf(line, "font %63s", name) != 1) {
+                fprintf(stderr, "%s:%d: expected the font's name\n", argv[1], line_number);
+                return 1;
+            }
+            continue;
+        }
+
+        /* then each glyph starts with its character */
+        if (strncmp(line, "glyph ", 6) == 0) {
+            int c, width = -1;
+            if (strncmp(line + 6, "space", 5) == 0) {
+                c = ' ';
+                sscanf(line + 11, "%d", &width);
+            } else {
+                c = (unsigned char) line[6];
+                sscanf(line + 7, "%d", &width);
+            }
+            if (c < FIRST_CHAR || c > LAST_CHAR || width > 8) {
+                fprintf(stderr, "%s:%d: bad glyph\n", argv[1], line_number);
+                return 1;
+            }
+            glyph = c - FIRST_CHAR;
+            widths[glyph] = width;
+            rows = 0;
+            continue;
+        }
+
+        /* and the rows of it */
+        if (glyph < 0 || rows == GLYPH_HEIGHT || strlen(line) > 8) {
+            fprintf(stderr, "%s:%d: a glyph has up to %d rows of up to 8 pixels\n",
+                    argv[1], line_number, GLYPH_HEIGHT);
+            return 1;
+        }
+        for (int x = 0; line[x] != '\0'; x++) {
+            if (line[x] == 'X') {
+                glyphs[glyph][rows] |= 1 << x;
+            }
+        }
+        rows++;
+    }
+    fclose(in);
+
+    /* work out the widths which were not given */
+    for (int i = 0; i < GLYPHS; i++) {
+        if (widths[i] >= 0) {
+            continue;
+        }
+        int ink = 0;
+        for (int y = 0; y < GLYPH_HEIGHT; y++) {
+            ink |= glyphs[i][y];
+        }
+        widths[i] = 0;
+        while (ink >> widths[i]) {
+            widths[i]++;
+        }
+        if (widths[i] > 0 && widths[i] < 8) {
+            widths[i]++;
+        }
+    }
+
+    FILE* out = fopen(argv[2], "w");
+    if (out == NULL) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    fprintf(out, "/* %s\n * generated by mkfont program */\n\n", argv[2]);
+    fprintf(out, "#define %s_first %d\n", name, FIRST_CHAR);
+    fprintf(out, "#define %s_count %d\n", name, GLYPHS);
+    fprintf(out, "#define %s_height %d\n\n", name, GLYPH_HEIGHT);
+
+    /* a row of each glyph per byte with bit 0 on the left, which is the
+     * order the hardware puts pixels in */
+    fprintf(out, "const unsigned char %s_glyphs [] __attribute__((aligned(4))) = {\n", name);
+    for (int i = 0; i < GLYPHS; i++) {
+        fprintf(out, "    ");
+        for (int y = 0; y < GLYPH_HEIGHT; y++) {
+            fprintf(out, "0x%02x,%s", glyphs[i][y], y == GLYPH_HEIGHT - 1 ? "" : " ");
+        }
+        fprintf(out, "  /* '%c' */\n", i + FIRST_CHAR);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const unsigned char %s_widths [] = {\n", name);
+    for (int i = 0; i < GLYPHS; i++) {
+        fprintf(out, "%s%d,%s", i % 16 == 0 ? "    " : "", widths[i],
+                i % 16 == 15 || i == GLYPHS - 1 ? "\n" : " ");
+    }
+    fprintf(out, "};\n\n");
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * mkmeta.c
+ * turns a text list of metasprites into the metasprites.h tables which
+ * metasprite.c draws
+ *
+ * each line is a metasprite name followed by its parts, each written as
+ * WIDTHxHEIGHT@X,Y:TILE with the offset from the top left corner, # starts
+ * a comment:
+ *
+ *     boss 64x64@0,0:0 32x32@64,16:128
+ *
+ * usage: mkmeta metasprites.txt metasprites.h
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* the sprite shapes the hardware has, as width, height, shape and size bits
+ * in the same order as enum SpriteSize */
+static const int shapes[12][4] = {
+    {8, 8, 0, 0}, {16, 16, 0, 1}, {32, 32, 0, 2}, {64, 64, 0, 3},
+    {16, 8, 1, 0}, {32, 8, 1, 1}, {32, 16, 1, 2}, {64, 32, 1, 3},
+    {8, 16, 2, 0}, {8, 32, 2, 1}, {16, 32, 2, 2}, {32, 64, 2, 3}
+};
+
+/* the parts of the metasprite being read */
+#define MAX_PARTS 128
+static int part_shape[MAX_PARTS], part_x[MAX_PARTS], part_y[MAX_PARTS], part_tile[MAX_PARTS];
+
+int main(int argc, char** argv) {
+    char line[2048], name[64];
+    int line_number = 0;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s metasprites.txt metasprites.h\n", argv[0]);
+        return 1;
+    }
+
+    FILE* in = fopen(argv[1], "r");
+    if (in == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    FILE* out = fopen(argv[2], "w");
+    if (out == NULL) {
+        perror(argv[2]);
+        return 1;
+    }
+    fprintf(out, "/* %s\n * generated by mkmeta program */\n\n", argv[2]);
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        line_number++;
+
+        char* comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+
+        int used;
+        if (sscanf(line, "%63s%n", name, &used) != 1) {
+            continue;
+        }
+
+        /* read the parts and find the box around them */
+        int count = 0, width = 0, height = 0, n, w, h, x, y, tile;
+        char* p = line + used;
+        while (count < MAX_PARTS && sscanf(p, " %dx%d@%d,%d:%d%n", &w, &h, &x, &y, &tile, &n) == 5) {
+            int s;
+            for (s = 0; s < 12; s++) {
+                if (shapes[s][0] == w && shapes[s][1] == h) {
+                    break;
+                }
+            }
+            if (s == 12 || x < 0 || y < 0 || tile < 0 || tile > 1023) {
+                fprintf(stderr, "%s:%d: bad part\n", argv[1], line_number);
+                return 1;
+            }
+            part_shape[count] = s;
+            part_x[count] = x;
+            part_y[count] = y;
+            part_tile[count] = tile;
+            if (x + w > width) {
+                width = x + w;
+            }
+            if (y + h > height) {
+                height = y + h;
+            }
+            count++;
+            p += n;
+        }
+        if (count == 0) {
+            fprintf(stderr, "%s:%d: no parts\n", argv[1], line_number);
+            return 1;
+        }
+
+        /* the parts, with the 256 color bit and the shape and size bits, and
+         * the offsets mirrored inside the box for when it is flipped */
+        fprintf(out, "const struct MetaPart %s_parts [] = {\n", name);
+        for (int i = 0; i < count; i++) {
+            const int* shape = shapes[part_shape[i]];
+            fprintf(out, "    {0x%04x, 0x%04x, %d, {%d, %d}, {%d, %d}},\n",
+                    (1 << 13) | (shape[2] << 14), shape[3] << 14, part_tile[i],
+                    part_x[i], width - part_x[i] - shape[0],
+                    part_y[i], height - part_y[i] - shape[1]);
+        }
+        fprintf(out, "};\n\nconst struct MetaSprite %s = {\n", name);
+        fprintf(out, "    %s_parts, %d, %d, %d\n};\n\n", name, count, width, height);
+    }
+
+    fclose(in);
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * mkreplay.c
+ * turns a text script of button presses into a replay in a .sav file, by
+ * feeding the script through the recorder in input.c on the host shim
+ *
+ * each line of the script is a list of buttons joined by + (or - for none)
+ * and the number of frames to hold them for, # starts a comment:
+ *
+ *     RIGHT 120
+ *     RIGHT+A 10
+ *     - 30
+ *
+ * usage: mkreplay script.txt out.sav
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gba.h"
+#include "input.h"
+
+/* the names of the buttons in the order of their bits */
+static const char* button_names[] = {
+    "A", "B", "SELECT", "START", "RIGHT", "LEFT", "UP", "DOWN", "R", "L"
+};
+
+/* turn a list of button names into a mask, returns -1 on a bad name */
+static int parse_buttons(char* list) {
+    int mask = 0;
+
+    if (strcmp(list, "-") == 0) {
+        return 0;
+    }
+    for (char* name = strtok(list, "+"); name != NULL; name = strtok(NULL, "+")) {
+        int i;
+        for (i = 0; i < 10; i++) {
+            if (strcmp(name, button_names[i]) == 0) {
+                break;
+            }
+        }
+        if (i == 10) {
+            return -1;
+        }
+        mask |= 1 << i;
+    }
+    return mask;
+}
+
+int main(int argc, char** argv) {
+    char line[256], list[128];
+    int frames, line_number = 0;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s script.txt out.sav\n", argv[0]);
+        return 1;
+    }
+
+    FILE* script = fopen(argv[1], "r");
+    if (script == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    input_record_start();
+    while (fgets(line, sizeof(line), script) != NULL) {
+        line_number++;
+
+        /* skip comments and blank lines */
+        char* comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+        if (sscanf(line, "%127s", list) != 1) {
+            continue;
+        }
+
+        int mask;
+        if (sscanf(line, "%127s %d", list, &frames) != 2 || frames < 0 ||
+                (mask = parse_buttons(list)) < 0) {
+            fprintf(stderr, "%s:%d: bad line\n", argv[1], line_number);
+            return 1;
+        }
+
+        /* the button register is active low */
+        *buttons = ~mask & BUTTON_MASK;
+        for (int i = 0; i < frames; i++) {
+            input_poll();
+        }
+    }
+    input_record_stop();
+    fclose(script);
+
+    FILE* out = fopen(argv[2], "wb");
+    if (out == NULL) {
+        perror(argv[2]);
+        return 1;
+    }
+    fwrite(host_sram, 1, SRAM_SIZE, out);
+    fclose(out);
+
+    printf("%s: %lu frames\n", argv[2], input_frame);
+    return 0;
+}
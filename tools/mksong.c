@@ -0,0 +1,281 @@
+/*
+ * mksong.c
+ * turns a text tracker song into the packed tables music.c plays straight
+ * out of ROM
+ *
+ * a song has a name, a speed in frames per row, instruments, patterns and
+ * an order, lines starting with # are comments:
+ *
+ *     song theme
+ *     speed 8
+ *     instrument lead square 2 12 3
+ *     instrument hat noise 0 8 1
+ *     pattern intro
+ *     C-4:lead ... C-6:hat
+ *     ... ... ...
+ *     order intro intro
+ *
+ * an instrument is a name, the channel it is for (square or noise), the
+ * duty cycle (0-3, squares only), the starting volume (0-15) and the
+ * envelope step (1-7 fades out, 0 holds), each pattern row has a column
+ * for square 1, square 2 and noise, with a note and octave and the
+ * instrument, ... for nothing or === to stop the channel
+ *
+ * each row is packed as a byte with a bit for each channel which has an
+ * event followed by a note and an instrument byte for each, runs of empty
+ * rows are a byte with the top bit set and the number of rows, and a 0
+ * byte ends the pattern
+ *
+ * usage: mksong theme.txt theme.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_INSTRUMENTS 64
+#define MAX_PATTERNS 64
+#define MAX_ORDER 256
+#define MAX_DATA 65536
+#define CHANNELS 3
+
+/* the note which stops a channel */
+#define NOTE_OFF 0xff
+
+/* the instruments */
+static char instrument_name[MAX_INSTRUMENTS][32];
+static int instrument_noise[MAX_INSTRUMENTS];
+static int instrument_envelope[MAX_INSTRUMENTS];
+static int instrument_count = 0;
+
+/* the patterns, packed one after another */
+static char pattern_name[MAX_PATTERNS][32];
+static int pattern_offset[MAX_PATTERNS];
+static int pattern_count = 0;
+static unsigned char data[MAX_DATA];
+static int data_size = 0;
+
+/* the order the patterns play in */
+static int order[MAX_ORDER];
+static int order_length = 0;
+
+/* the run of empty rows not written yet */
+static int empty_rows = 0;
+
+static const char* path;
+static int line_number = 0;
+
+static void fail(const char* message) {
+    fprintf(stderr, "%s:%d: %s\n", path, line_number, message);
+    exit(1);
+}
+
+static void put(int byte) {
+    if (data_size == MAX_DATA) {
+        fail("song too big");
+    }
+    data[data_size++] = byte;
+}
+
+/* write out any empty rows waiting */
+static void flush_empty() {
+    while (empty_rows > 0) {
+        int run = empty_rows > 127 ? 127 : empty_rows;
+        put(0x80 | run);
+        empty_rows -= run;
+    }
+}
+
+/* read a note like C-4 or F#5, returns its number counting semitones up
+ * from C-0 */
+static int parse_note(const char* text) {
+    static const int semitones[7] = {9, 11, 0, 2, 4, 5, 7};
+    if (text[0] < 'A' || text[0] > 'G' || (text[1] != '-' && text[1] != '#') ||
+            text[2] < '0' || text[2] > '7') {
+        fail("bad note");
+    }
+    return (text[2] - '0') * 12 + semitones[text[0] - 'A'] + (text[1] == '#');
+}
+
+static int find_instrument(const char* name) {
+    for (int i = 0; i < instrument_count; i++) {
+        if (strcmp(instrument_name[i], name) == 0) {
+            return i;
+        }
+    }
+    fail("unknown instrument");
+    return 0;
+}
+
+static int find_pattern(const char* name) {
+    for (int i = 0; i < pattern_count; i++) {
+        if (strcmp(pattern_name[i], name) == 0) {
+            return i;
+        }
+    }
+    fail("unknown pattern");
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    char line[1024], word[64], name[32] = "", kind[16];
+    int speed = 6, in_pattern = 0;
+
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s theme.txt theme.h\n", argv[0]);
+        return 1;
+    }
+    path = argv[1];
+
+    FILE* in = fopen(path, "r");
+    if (in == NULL) {
+        perror(path);
+        return 1;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        line_number++;
+        int used;
+        if (sscanf(line, "%63s%n", word, &used) != 1 || word[0] == '#') {
+            continue;
+        }
+        char* rest = line + used;
+
+        if (strcmp(word, "song") == 0) {
+            if (sscanf(rest, "%31s", name) != 1) {
+                fail("expected a name");
+            }
+        } else if (strcmp(word, "speed") == 0) {
+            if (sscanf(rest, "%d", &speed) != 1 || speed < 1 || speed > 255) {
+                fail("bad speed");
+            }
+        } else if (strcmp(word, "instrument") == 0) {
+            int duty, volume, step;
+            if (instrument_count == MAX_INSTRUMENTS) {
+                fail("too many instruments");
+            }
+            if (sscanf(rest, "%31s %15s %d %d %d", instrument_name[instrument_count], kind,
+                        &duty, &volume, &step) != 5 || duty < 0 || duty > 3 ||
+                    volume < 0 || volume > 15 || step < 0 || step > 7) {
+                fail("bad instrument");
+            }
+
+            /* the envelope register, step 0 holds the volume and anything
+             * else fades it down */
+            instrument_noise[instrument_count] = strcmp(kind, "noise") == 0;
+            if (!instrument_noise[instrument_count] && strcmp(kind, "square") != 0) {
+                fail("instruments are square or noise");
+            }
+            instrument_envelope[instrument_count] = (duty << 6) | (step << 8) | (volume << 12);
+            instrument_count++;
+        } else if (strcmp(word, "pattern") == 0) {
+            if (in_pattern) {
+                flush_empty();
+                put(0);
+            }
+            if (pattern_count == MAX_PATTERNS || sscanf(rest, "%31s", pattern_name[pattern_count]) != 1) {
+                fail("bad pattern");
+            }
+            pattern_offset[pattern_count++] = data_size;
+            in_pattern = 1;
+        } else if (strcmp(word, "order") == 0) {
+            char* p = rest;
+            char pattern[32];
+            int n;
+            while (sscanf(p, "%31s%n", pattern, &n) == 1) {
+                if (order_length == MAX_ORDER) {
+                    fail("order too long");
+                }
+                order[order_length++] = find_pattern(pattern);
+                p += n;
+            }
+        } else if (in_pattern) {
+            /* a row, the first word has already been read */
+            char cells[CHANNELS][32];
+            strcpy(cells[0], word);
+            if (sscanf(rest, "%31s %31s", cells[1], cells[2]) != 2) {
+                fail("rows have three columns");
+            }
+
+            int mask = 0, notes[CHANNELS], instruments[CHANNELS];
+            for (int c = 0; c < CHANNELS; c++) {
+                if (strcmp(cells[c], "...") == 0) {
+                    continue;
+                }
+                mask |= 1 << c;
+                if (strcmp(cells[c], "===") == 0) {
+                    notes[c] = NOTE_OFF;
+                    instruments[c] = 0;
+                    continue;
+                }
+                char* colon = strchr(cells[c], ':');
+                if (colon == NULL) {
+                    fail("notes are written NOTE:instrument");
+                }
+                *colon = '\0';
+                notes[c] = parse_note(cells[c]);
+                instruments[c] = find_instrument(colon + 1);
+                if (instrument_noise[instruments[c]] != (c == 2)) {
+                    fail("the last column is for noise and the others are for squares");
+                }
+            }
+
+            if (mask == 0) {
+                empty_rows++;
+                continue;
+            }
+            flush_empty();
+            put(mask);
+            for (int c = 0; c < CHANNELS; c++) {
+                if (mask & (1 << c)) {
+                    put(notes[c]);
+                    put(instruments[c]);
+                }
+            }
+        } else {
+            fail("unknown line");
+        }
+    }
+    fclose(in);
+
+    if (in_pattern) {
+        flush_empty();
+        put(0);
+    }
+    if (name[0] == '\0' || order_length == 0) {
+        fprintf(stderr, "%s: a song needs a name and an order\n", path);
+        return 1;
+    }
+
+    FILE* out = fopen(argv[2], "w");
+    if (out == NULL) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    int size = instrument_count * 2 + data_size + pattern_count * 2 + order_length;
+    fprintf(out, "/* %s\n * generated by mksong program */\n\n", argv[2]);
+
+    fprintf(out, "const unsigned short %s_instruments [] = {\n", name);
+    for (int i = 0; i < instrument_count; i++) {
+        fprintf(out, "    0x%04x,\n", instrument_envelope[i]);
+    }
+    fprintf(out, "};\n\nconst unsigned char %s_patterns [] = {\n", name);
+    for (int i = 0; i < data_size; i++) {
+        fprintf(out, "%s0x%02x,%s", i % 12 == 0 ? "    " : "", data[i],
+                i % 12 == 11 || i == data_size - 1 ? "\n" : " ");
+    }
+    fprintf(out, "};\n\nconst unsigned short %s_pattern_offsets [] = {\n", name);
+    for (int i = 0; i < pattern_count; i++) {
+        fprintf(out, "    %d,\n", pattern_offset[i]);
+    }
+    fprintf(out, "};\n\nconst unsigned char %s_order [] = {\n", name);
+    for (int i = 0; i < order_length; i++) {
+        fprintf(out, "    %d,\n", order[i]);
+    }
+    fprintf(out, "};\n\nconst struct Song %s = {\n", name);
+    fprintf(out, "    \"%s\", %s_instruments, %s_patterns, %s_pattern_offsets,\n", name, name, name, name);
+    fprintf(out, "    %s_order, %d, %d, %d\n};\n\n", name, order_length, speed, size);
+    fclose(out);
+    return 0;
+}
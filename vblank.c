@@ -0,0 +1,85 @@
+/*
+ * vblank.c
+ * the vblank work queue
+ */
+
+#include "gba.h"
+#include "profile.h"
+#include "vblank.h"
+
+/* the tasks waiting to run, in the order they were added */
+static struct VblankTask vblank_tasks[VBLANK_MAX_TASKS];
+static int vblank_count = 0;
+
+/* the scanline the last vblank's work finished on */
+unsigned short vblank_end_line = 0;
+
+/* counts of overruns and deferred tasks */
+unsigned int vblank_overruns = 0;
+unsigned int vblank_deferred = 0;
+
+/* add a task to the queue */
+int vblank_add(void (*run)(void* data), void* data, unsigned int words,
+        enum VblankPriority priority) {
+    if (vblank_count >= VBLANK_MAX_TASKS) {
+        return 0;
+    }
+
+    vblank_tasks[vblank_count].run = run;
+    vblank_tasks[vblank_count].data = data;
+    vblank_tasks[vblank_count].words = words;
+    vblank_tasks[vblank_count].priority = priority;
+    vblank_count++;
+    return 1;
+}
+
+/* the cycles left before the display starts drawing the next frame */
+static int vblank_cycles_left() {
+    unsigned short line = profile_scanline();
+
+    /* once the display is drawing again there is no time left */
+    if (line < SCREEN_HEIGHT) {
+        return 0;
+    }
+    return (SCANLINES_PER_FRAME - line) * CYCLES_PER_SCANLINE;
+}
+
+/* run as much of the queue as fits in what is left of vblank */
+void vblank_run() {
+    int kept = 0;
+
+    /* go through the tasks one priority at a time */
+    for (int priority = 0; priority < VBLANK_PRIORITIES; priority++) {
+        for (int i = 0; i < vblank_count; i++) {
+            struct VblankTask* task = &vblank_tasks[i];
+            if (task->run == 0 || task->priority != priority) {
+                continue;
+            }
+
+            /* put the task off if it would not finish in time */
+            int cost = VBLANK_TASK_CYCLES + task->words * VBLANK_CYCLES_PER_WORD;
+            if (priority != VBLANK_CRITICAL && cost > vblank_cycles_left()) {
+                continue;
+            }
+
+            task->run(task->data);
+            task->run = 0;
+        }
+    }
+
+    /* move the tasks which were put off to the front of the queue */
+    for (int i = 0; i < vblank_count; i++) {
+        if (vblank_tasks[i].run != 0) {
+            vblank_tasks[kept++] = vblank_tasks[i];
+        }
+    }
+    vblank_deferred += kept;
+    vblank_count = kept;
+
+    /* if the display has started drawing again, the work ran over */
+    vblank_end_line = profile_scanline();
+    if (vblank_end_line < SCREEN_HEIGHT) {
+        vblank_overruns++;
+        profile_overrun();
+    }
+}
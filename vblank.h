@@ -0,0 +1,54 @@
+/*
+ * vblank.h
+ * a queue of work to do during vblank, each task comes with an estimate of
+ * its cost so low priority work can be put off to the next frame rather than
+ * spilling past the end of vblank and tearing the screen
+ */
+
+#ifndef VBLANK_H
+#define VBLANK_H
+
+/* the priorities of vblank tasks, critical tasks always run */
+enum VblankPriority {
+    VBLANK_CRITICAL,
+    VBLANK_NORMAL,
+    VBLANK_LOW,
+    VBLANK_PRIORITIES
+};
+
+/* the most tasks which can be waiting at once */
+#define VBLANK_MAX_TASKS 16
+
+/* the estimated cost of a task, a fixed overhead plus its DMA transfers */
+#define VBLANK_TASK_CYCLES 64
+#define VBLANK_CYCLES_PER_WORD 4
+
+/* a piece of work to do during vblank */
+struct VblankTask {
+    /* the function to call and what to pass it */
+    void (*run)(void* data);
+    void* data;
+
+    /* the number of words the task transfers */
+    unsigned int words;
+
+    enum VblankPriority priority;
+};
+
+/* the scanline the last vblank's work finished on */
+extern unsigned short vblank_end_line;
+
+/* the number of frames whose vblank work ran into the next frame, and the
+ * number of tasks which have been put off to a later frame */
+extern unsigned int vblank_overruns;
+extern unsigned int vblank_deferred;
+
+/* add a task to the queue, returns 0 if the queue is full */
+int vblank_add(void (*run)(void* data), void* data, unsigned int words,
+        enum VblankPriority priority);
+
+/* run as much of the queue as fits in what is left of vblank, this should be
+ * called right after wait_vblank */
+void vblank_run();
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * vwf.c
+ * variable width text
+ *
+ * a row of a glyph is a byte with a bit a pixel, which spreads out to a
+ * 32-bit word with four bits a pixel through a table, the word is shifted
+ * to the glyph's place in the line and ORed into the tile it starts in and
+ * the one after, so a glyph takes two ORs a row wherever it lands
+ */
+
+#include "gba.h"
+#include "text.h"
+#include "vwf.h"
+
+/* each byte of a glyph row spread out to a nibble a pixel */
+static unsigned int vwf_spread[256];
+static int vwf_spread_ready = 0;
+
+/* make the spread table */
+static void vwf_make_spread() {
+    for (int bits = 0; bits < 256; bits++) {
+        unsigned int row = 0;
+        for (int x = 0; x < 8; x++) {
+            if (bits & (1 << x)) {
+                row |= 1 << (x * 4);
+            }
+        }
+        vwf_spread[bits] = row;
+    }
+    vwf_spread_ready = 1;
+}
+
+/* take the box's tiles and put them in the map */
+int vwf_init(struct VwfBox* box) {
+    if (!vwf_spread_ready) {
+        vwf_make_spread();
+    }
+    if (box->width > VWF_MAX_WIDTH || box->lines > VWF_MAX_LINES) {
+        return 0;
+    }
+
+    box->first_tile = text_alloc_tiles(box->width * box->lines);
+    if (box->first_tile < 0) {
+        return 0;
+    }
+
+    /* the lines start out empty, and are uploaded that way */
+    for (int line = 0; line < box->lines; line++) {
+        box->text[line][0] = '\0';
+        for (int i = 0; i < box->width * 8; i++) {
+            box->pixels[line][i] = 0;
+        }
+        for (int x = 0; x < box->width; x++) {
+            text_put(box->x + x, box->y + line, box->first_tile + line * box->width + x);
+        }
+    }
+    box->dirty = (1 << box->lines) - 1;
+    return 1;
+}
+
+/* the glyph for a character, anything the font does not have is a space */
+static int vwf_glyph(char c) {
+    int glyph = c - text_font.first;
+    if (glyph < 0 || glyph >= text_font.count) {
+        return 0;
+    }
+    return glyph;
+}
+
+/* the width of a string in pixels */
+int vwf_measure(const char* string) {
+    int width = 0;
+    for (; *string != '\0'; string++) {
+        width += text_font.widths[vwf_glyph(*string)];
+    }
+    return width;
+}
+
+/* draw a line of text into its strip of tiles */
+IWRAM_CODE static void vwf_draw(struct VwfBox* box, int line) {
+    unsigned int* pixels = box->pixels[line];
+    unsigned int color = box->color;
+    int right = box->width * 8;
+    int x = 0;
+
+    for (int i = 0; i < box->width * 8; i++) {
+        pixels[i] = 0;
+    }
+
+    for (const char* c = box->text[line]; *c != '\0'; c++) {
+        int glyph = vwf_glyph(*c);
+        int width = text_font.widths[glyph];
+        if (x + width > right) {
+            break;
+        }
+
+        /* the tile the glyph starts in, and how far into it, a glyph which
+         * starts at the left of a tile stays in it */
+        const unsigned char* rows = text_font.glyphs + glyph * text_font.height;
+        unsigned int* dest = pixels + (x >> 3) * 8;
+        int shift = (x & 7) * 4;
+        int spills = shift != 0 && (x >> 3) + 1 < box->width;
+
+        for (int y = 0; y < text_font.height; y++) {
+            if (rows[y] == 0) {
+                continue;
+            }
+            unsigned int row = vwf_spread[rows[y]] * color;
+            dest[y] |= row << shift;
+            if (spills) {
+                dest[y + 8] |= row >> (32 - shift);
+            }
+        }
+        x += width;
+    }
+}
+
+/* set the text of a line */
+void vwf_print(struct VwfBox* box, int line, const char* string) {
+    char* text = box->text[line];
+    int i;
+
+    if (line < 0 || line >= box->lines) {
+        return;
+    }
+
+    /* leave the line alone if it already says this, as far as a line can
+     * hold */
+    i = 0;
+    while (i < VWF_LINE_CHARS - 1 && string[i] != '\0' && text[i] == string[i]) {
+        i++;
+    }
+    if (i == VWF_LINE_CHARS - 1 || text[i] == string[i]) {
+        return;
+    }
+
+    for (i = 0; i < VWF_LINE_CHARS - 1 && string[i] != '\0'; i++) {
+        text[i] = string[i];
+    }
+    text[i] = '\0';
+
+    vwf_draw(box, line);
+    box->dirty |= 1 << line;
+}
+
+/* the number of words drawn since the last upload */
+int vwf_pending(struct VwfBox* box) {
+    int words = 0;
+    for (int line = 0; line < box->lines; line++) {
+        if (box->dirty & (1 << line)) {
+            words += box->width * 8;
+        }
+    }
+    return words;
+}
+
+/* copy the lines which were drawn into VRAM */
+void vwf_upload(struct VwfBox* box) {
+    for (int line = 0; line < box->lines; line++) {
+        if (box->dirty & (1 << line)) {
+            memcpy32_dma((void*) text_tile(box->first_tile + line * box->width),
+                    box->pixels[line], box->width * 8);
+        }
+    }
+    box->dirty = 0;
+}
+
+/* the vblank task which uploads a box */
+void vwf_task(void* data) {
+    vwf_upload((struct VwfBox*) data);
+}
@@ -0,0 +1,57 @@
+/*
+ * vwf.h
+ * variable width text, the glyphs are drawn at their own widths into a box
+ * of tiles on the text layer, each line of the box is a strip of tiles
+ * which is only drawn again when its text changes
+ */
+
+#ifndef VWF_H
+#define VWF_H
+
+/* the biggest box, in tiles, and the longest line of text */
+#define VWF_MAX_WIDTH 30
+#define VWF_MAX_LINES 4
+#define VWF_LINE_CHARS 64
+
+/* a box of variable width text */
+struct VwfBox {
+    /* where the box is on the text layer and its size, in tiles */
+    int x, y;
+    int width, lines;
+
+    /* the color of the ink in the text layer's palette bank, 1 to 15 */
+    int color;
+
+    /* the first of the box's tiles, a line at a time left to right */
+    int first_tile;
+
+    /* the text of each line, the lines drawn since the last upload, and
+     * the drawn lines themselves laid out the way the tiles are */
+    char text[VWF_MAX_LINES][VWF_LINE_CHARS];
+    unsigned int dirty;
+    unsigned int pixels[VWF_MAX_LINES][VWF_MAX_WIDTH * 8];
+};
+
+/* take the box's tiles from the text layer and put them in its map, the
+ * position, size and color are filled in first, returns 0 if there is not
+ * room for the tiles */
+int vwf_init(struct VwfBox* box);
+
+/* the width of a string in pixels */
+int vwf_measure(const char* string);
+
+/* set the text of a line, it is only drawn again if it changed, anything
+ * past the right edge of the box is left out */
+void vwf_print(struct VwfBox* box, int line, const char* string);
+
+/* the number of words of the box's tiles which have been drawn since the
+ * last upload */
+int vwf_pending(struct VwfBox* box);
+
+/* copy the lines which were drawn into VRAM */
+void vwf_upload(struct VwfBox* box);
+
+/* the vblank task which uploads the box it is given */
+void vwf_task(void* data);
+
+#endif
@@ -0,0 +1,186 @@
+
+/*
+ * wave.c
+ * a wave of falling objects for the catcher game, more of them than the
+ * hardware has sprites, so the sprite multiplexer has to show them
+ */
+
+/* include these files */
+#include "gba.h"
+#include "input.h"
+#include "profile.h"
+#include "vblank.h"
+#include "interrupt.h"
+#include "sprite.h"
+#include "mux.h"
+#include "sound.h"
+#include "objects.h"
+
+/* the number of objects falling at once */
+#define NUM_OBJECTS 160
+
+/* the objects are 32x32 each, stacked in the image */
+#define OBJECT_SIZE 32
+#define OBJECT_KINDS (objects_height / OBJECT_SIZE)
+
+/* the number of tile index steps from one object to the next, 256 color
+ * tiles take two steps each */
+#define OBJECT_TILES ((OBJECT_SIZE / 8) * (OBJECT_SIZE / 8) * 2)
+
+/* the sound an object makes when it lands, a tenth of a second of a
+ * triangle wave which dies away, made when the demo starts */
+#define PLINK_LENGTH 1800
+#define PLINK_PERIOD 32
+signed char plink[PLINK_LENGTH];
+
+/* the plink each kind of object makes, they go up in pitch and the later
+ * ones matter more */
+struct SoundEffect plinks[OBJECT_KINDS];
+
+/* make the plink */
+void setup_sound() {
+    for (int i = 0; i < PLINK_LENGTH; i++) {
+        int phase = i % PLINK_PERIOD;
+        int wave = phase < PLINK_PERIOD / 2 ? phase * 16 - 128 : (PLINK_PERIOD - phase) * 16 - 128;
+        plink[i] = (wave * (PLINK_LENGTH - i)) / PLINK_LENGTH;
+    }
+    for (int kind = 0; kind < OBJECT_KINDS; kind++) {
+        plinks[kind].data = plink;
+        plinks[kind].length = PLINK_LENGTH;
+        plinks[kind].rate = SOUND_RATE + kind * SOUND_RATE / 4;
+        plinks[kind].volume = 16;
+        plinks[kind].priority = kind;
+    }
+    sound_init();
+}
+
+/* a falling object */
+struct Object {
+    int x, y;
+    int speed;
+    int tile;
+};
+
+/* a simple random number generator, so every run is the same */
+unsigned int random_state = 12345;
+unsigned int random_next() {
+    random_state = random_state * 1103515245 + 12345;
+    return random_state >> 16;
+}
+
+/* setup the sprite image and palette */
+void setup_sprite_image() {
+    /* load the palette from the image into palette memory*/
+    memcpy16_dma((unsigned short*) sprite_palette, (unsigned short*) objects_palette, PALETTE_SIZE);
+
+    /* load the image into sprite image memory */
+    memcpy16_dma((unsigned short*) sprite_image_memory, (unsigned short*) objects_data,
+            (objects_width * objects_height) / 2);
+}
+
+/* start an object off somewhere above the screen */
+void object_drop(struct Object* object) {
+    object->x = random_next() % (SCREEN_WIDTH - OBJECT_SIZE);
+    object->y = -OBJECT_SIZE - (random_next() % SCREEN_HEIGHT);
+    object->speed = 1 + (random_next() % 3);
+    object->tile = (random_next() % OBJECT_KINDS) * OBJECT_TILES;
+}
+
+/* move an object down, and drop it again once it falls off the bottom */
+void object_update(struct Object* object) {
+    object->y += object->speed;
+    if (object->y >= SCREEN_HEIGHT) {
+        /* each kind of object plinks at its own pitch */
+        int kind = object->tile / OBJECT_TILES;
+        sound_trigger(&plinks[kind], 0);
+        object_drop(object);
+    }
+}
+
+/* add an object to the sprites the multiplexer shows this frame */
+void object_show(struct Object* object) {
+    /* objects still above the screen are left out */
+    if (object->y <= -OBJECT_SIZE) {
+        return;
+    }
+
+    struct Sprite* sprite = mux_add();
+    if (sprite == 0) {
+        return;
+    }
+
+    sprite->attribute0 = (object->y & 0xff) |   /* y coordinate */
+                         (1 << 13);             /* 256 colors, square */
+    sprite->attribute1 = (object->x & 0x1ff) |  /* x coordinate */
+                         (2 << 14);             /* 32x32 */
+    sprite->attribute2 = object->tile;
+}
+
+/* the main function */
+int main() {
+    struct Object objects[NUM_OBJECTS];
+
+    /* we set the mode to mode 0 with just the sprites on */
+    *display_control = MODE0 | SPRITE_ENABLE | SPRITE_MAP_1D;
+
+    /* setup the sprite image data */
+    setup_sprite_image();
+
+    /* clear all the sprites on screen now */
+    sprite_clear();
+
+    /* the multiplexer takes all of the sprites */
+    interrupt_init();
+    mux_init();
+
+    /* start all of the objects off */
+    for (int i = 0; i < NUM_OBJECTS; i++) {
+        object_drop(&objects[i]);
+    }
+
+    /* start the sound */
+    setup_sound();
+
+    /* choose between the keypad and a recorded session */
+    input_init();
+
+    /* start timing the frames */
+    profile_init();
+
+    /* loop until the input runs out, which is never on the hardware */
+    while (input_poll()) {
+        profile_begin(PROFILE_FRAME);
+
+        /* move the objects */
+        profile_begin(PROFILE_UPDATE);
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            object_update(&objects[i]);
+        }
+        profile_end(PROFILE_UPDATE);
+
+        /* sort them into the sprites */
+        profile_begin(PROFILE_OAM);
+        mux_clear();
+        for (int i = 0; i < NUM_OBJECTS; i++) {
+            object_show(&objects[i]);
+        }
+        mux_build();
+        profile_end(PROFILE_OAM);
+
+        /* mix the sound for the next frame */
+        sound_mix();
+
+        vblank_add(sound_task, 0, 0, VBLANK_CRITICAL);
+        vblank_add(sprite_update_task, 0, SPRITE_OAM_WORDS, VBLANK_CRITICAL);
+        profile_end(PROFILE_FRAME);
+
+        /* wait for vblank before moving sprites */
+        wait_vblank();
+        profile_begin(PROFILE_VBLANK);
+        vblank_run();
+        profile_end(PROFILE_VBLANK);
+        profile_frame();
+    }
+
+    return 0;
+}